@@ -30,4 +30,24 @@ public:
 	
 	HashTab( ) { }
 	~HashTab( ) {  }
+
+	//  
+	int GetSize() const { return size; }
+
+	//   :  ,   
+	//         
+	void GetStatistics( int &count, int &longest, double &avgprobe ) const {
+		double probes = 0;
+		count = longest = 0;
+		for( int i = 0; i<size; i++ )
+		{
+			int len = table[i].size();
+			count += len;
+			probes += len * (len + 1) / 2.0;
+			if( len > longest )
+				longest = len;
+		}
+
+		avgprobe = count ? probes / count : 0;
+	}
 };
@@ -34,6 +34,11 @@ extern bool no_warnings;
 extern int code_page;
 
 
+//      ,   ,
+//   
+string statname;
+
+
 
 //    ,    '/D'
 inline void DoOption_D( char *s )
@@ -112,6 +117,7 @@ inline void ParseOptions( int argc, char *argv[] )
 	// /DName[=val] -  
 	// /W	  -   
 	// /L=code_page -     (  dos866)
+	// /SFile -         JSON
 	// /?	  -  
 
 	list<string> undef;	
@@ -153,6 +159,13 @@ inline void ParseOptions( int argc, char *argv[] )
 			else if( c == 'W' )
 				no_warnings = true;
 
+			else if( c == 'S' )
+			{
+				statname = (argv[i]+2);
+				if(statname == "")
+					Fatal("kpp:      '/S'" );
+			}
+
 			else if( c == 'L' )
 			{
 				temp = (argv[i]+2);
@@ -186,6 +199,27 @@ inline void ParseOptions( int argc, char *argv[] )
 }
 
 
+//       JSON
+inline void WriteStatistics( const char *fname )
+{
+	int count, longest;
+	double avgprobe;
+	mtab.GetStatistics( count, longest, avgprobe );
+
+	FILE *out = xfopen( fname, "w" );
+	fprintf( out, "{\n  \"macroTable\": {\n" );
+	fprintf( out, "    \"size\": %d,\n", mtab.GetSize() );
+	fprintf( out, "    \"count\": %d,\n", count );
+	fprintf( out, "    \"loadFactor\": %.4f,\n", (double)count / mtab.GetSize() );
+	fprintf( out, "    \"longestChain\": %d,\n", longest );
+	fprintf( out, "    \"averageProbe\": %.4f,\n", avgprobe );
+	fprintf( out, "    \"findCalls\": %d,\n", mtab.GetFindCount() );
+	fprintf( out, "    \"findHits\": %d\n", mtab.GetHitCount() );
+	fprintf( out, "  }\n}\n" );
+	fclose( out );
+}
+
+
 int main( int argc, char *argv[] )
 {
 	code_page = 866;
@@ -195,6 +229,8 @@ int main( int argc, char *argv[] )
 	linecount = 1;
 
 	FullPreprocessing(inname.c_str(), outname.c_str());
+	if( statname != "" )
+		WriteStatistics( statname.c_str() );
 	
 	return errcount ? ERROR_EXIT_CODE : warncount;
 }
@@ -21,7 +21,12 @@ MacroTable mtab;
 Macro *MacroTable::Find( char *name )
 {
 	list<Macro>::iterator i;
-	return _Find( name, i ) == false ? NULL : &(*i);
+	findCount++;
+	if( _Find( name, i ) == false )
+		return NULL;
+
+	hitCount++;
+	return &(*i);
 }
 
 
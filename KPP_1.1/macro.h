@@ -37,6 +37,9 @@ struct Macro
 //  
 class MacroTable : public HashTab<Macro, MACROTAB_SIZE>
 {
+	//      
+	int findCount, hitCount;
+
 	//    
 	bool _Find( char *name, list<Macro>::iterator &i ) {
 		list<Macro> &p = HashFunc( name );
@@ -46,9 +49,17 @@ class MacroTable : public HashTab<Macro, MACROTAB_SIZE>
 	}
 
 public:
+	MacroTable( ) : findCount(0), hitCount(0) { }
+
 	//      ,  NULL
 	Macro *Find( char *name );
 
+	//  
+	int GetFindCount() const { return findCount; }
+
+	//   
+	int GetHitCount() const { return hitCount; }
+
 
 	//    
 	void Insert( Macro ob );
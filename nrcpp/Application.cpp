@@ -14,16 +14,38 @@ using namespace NRC;
 #include "Class.h"
 #include "Parser.h"
 #include "Manager.h"
+#include "Body.h"
+#include "Checker.h"
+#include "ExpressionMaker.h"
 
 
 //     
 Application theApp;
 
 
+//    
+LookupCounter CompilerStatistics::deepSearch;
+LookupCounter CompilerStatistics::findSymbol;
+LookupCounter CompilerStatistics::findInScope;
+unsigned CompilerStatistics::accessChecks;
+unsigned CompilerStatistics::overloadResolutions;
+LookupCounter CompilerStatistics::conversionCache;
+LookupCounter CompilerStatistics::exactMatches;
+
+
+//    
+bool MemoryStatistics::enabled = false;
+MemoryStatistics::Counter MemoryStatistics::counters[MemoryStatistics::MS_COUNT];
+vector<MemoryStatistics::Phase> MemoryStatistics::phases;
+
+
 
 //      
 TranslationUnit::TranslationUnit( PCSTR fnam ) 
 {
+	//        
+	Identifier::SetArena(&semanticArena);
+
 	fileName = fnam;
 	shortFileName = fnam;
 	
@@ -32,12 +54,11 @@ TranslationUnit::TranslationUnit( PCSTR fnam )
 		shortFileName = shortFileName.DeleteRightWhileNot("\\/");
 
 	inStream = fopen(fileName, "r");
-	currentPos.line = 1;
 
 	if( !inStream )
 		theApp.Fatal("'%s' -   ", fileName.c_str() );
 
-	lexicalAnalyzer = new LexicalAnalyzer( inStream, currentPos );
+	lexicalAnalyzer = new LexicalAnalyzer( inStream );
 	parser = new Parser(*lexicalAnalyzer);	
 
 	//     ,   
@@ -57,6 +78,52 @@ TranslationUnit::~TranslationUnit()
 	fclose(inStream);
 	delete lexicalAnalyzer;
 	delete parser;
+
+	//         .
+	//  ,   , ..  
+	//   ,       
+	//     
+	const SymbolTable *global = scope->GetFirstSymbolTable();
+	INTERNAL_IF( !global->IsGlobalSymbolTable() );
+	delete scope;
+	delete static_cast<GeneralSymbolTable *>(const_cast<SymbolTable *>(global));
+
+	//     , ..  
+	//      
+	ResetStaticCaches();
+	Identifier::DestroyArenaIdentifiers();
+
+	//      , 
+	//      
+	Identifier::SetArena(NULL);
+}
+
+
+//   ,     .
+//      ,   
+//      
+void TranslationUnit::ResetStaticCaches()
+{
+	OverloadResolutor::ClearCache();
+	AutoCastManager::ClearCache();
+	CanonicalTypeTable::Clear();
+	NameManager::ClearCache();
+	AccessControlChecker::ClearCache();
+	LocalSymbolTable::ReleaseFreeList();
+}
+
+
+//   
+Position TranslationUnit::GetPosition() const
+{
+	return lexicalAnalyzer->GetCurrentPosition();
+}
+
+
+//        
+void TranslationUnit::GetLineAndColumn( const Position &pos, unsigned &line, unsigned &col ) const
+{
+	lexicalAnalyzer->GetLineAndColumn(pos, line, col);
 }
 
 
@@ -122,6 +189,301 @@ void TranslationUnit::Compile()
 }
 
 
+//        
+void TranslationUnit::LexOnly()
+{
+	LexicalStatistics stat;
+
+	stat.Run(*lexicalAnalyzer);
+	stat.Print(shortFileName.c_str());
+}
+
+
+//     JSON
+static void WriteJsonString( FILE *out, const string &s )
+{
+	fputc( '\"', out );
+	for( string::const_iterator p = s.begin(); p != s.end(); p++ )
+	{
+		if( *p == '\"' || *p == '\\' )
+			fputc( '\\', out );
+		fputc( *p, out );
+	}
+
+	fputc( '\"', out );
+}
+
+
+//    -   JSON
+static void WriteHashTabStatistics( FILE *out, const string &name, 
+		const HashTab &ht, bool &first )
+{
+	unsigned longest;
+	double avgProbe;
+	ht.GetProbeStatistics( longest, avgProbe );
+
+	fprintf( out, first ? "\n    { \"scope\": " : ",\n    { \"scope\": " );
+	WriteJsonString( out, name );
+	fprintf( out, ", \"names\": %u, \"size\": %u, \"loadFactor\": %.4f, "
+		"\"longestChain\": %u, \"averageProbe\": %.4f }",
+		ht.GetCount(), ht.GetSize(), ht.GetLoadFactor(), longest, avgProbe );
+	first = false;
+}
+
+
+//  -     , 
+//    ht
+static void CollectHashTabs( const HashTab &ht, 
+		vector<const NameSpace *> &nsList, vector<const ClassType *> &clsList )
+{
+	for( unsigned i = 0; i<ht.GetSize(); i++ )
+	{
+		const IdentifierVector *il = ht.GetSlot(i);
+		if( il == NULL )
+			continue;
+
+		//   using-    ,
+		//   ,  
+		for( IdentifierVector::const_iterator p = il->begin(); p != il->end(); p++ )
+		{
+			if( const NameSpace *ns = dynamic_cast<const NameSpace *>(*p) )
+			{
+				if( find(nsList.begin(), nsList.end(), ns) == nsList.end() )
+				{
+					nsList.push_back(ns);
+					CollectHashTabs(ns->GetHashTab(), nsList, clsList);
+				}
+			}
+
+			else if( const ClassType *cls = dynamic_cast<const ClassType *>(*p) )
+			{
+				if( find(clsList.begin(), clsList.end(), cls) == clsList.end() )
+				{
+					clsList.push_back(cls);
+					CollectHashTabs(cls->GetMemberList().GetMemberIndex(), nsList, clsList);
+				}
+			}
+		}
+	}
+}
+
+
+//           JSON
+void TranslationUnit::WriteStatistics( PCSTR fname ) const
+{
+	FILE *out = fopen( fname, "w" );
+	if( out == NULL )
+		theApp.Fatal( "'%s' -     ", fname );
+
+	const GeneralSymbolTable &global = 
+		static_cast<const GeneralSymbolTable &>(*scope->GetFirstSymbolTable());
+	vector<const NameSpace *> nsList;
+	vector<const ClassType *> clsList;
+	CollectHashTabs( global.GetHashTab(), nsList, clsList );
+	
+	fprintf( out, "{\n  \"file\": " );
+	WriteJsonString( out, shortFileName.c_str() );
+
+	//      
+	bool first = true;
+	fprintf( out, ",\n  \"hashTables\": [" );
+	WriteHashTabStatistics( out, "::", global.GetHashTab(), first );
+	for( vector<const NameSpace *>::iterator pns = nsList.begin(); pns != nsList.end(); pns++ )
+		WriteHashTabStatistics( out, (*pns)->GetQualifiedName().c_str(), 
+			(*pns)->GetHashTab(), first );
+	fprintf( out, "\n  ],\n" );
+
+	//   
+	first = true;
+	fprintf( out, "  \"classMemberLists\": [" );
+	for( vector<const ClassType *>::iterator pcls = clsList.begin(); pcls != clsList.end(); pcls++ )
+		WriteHashTabStatistics( out, (*pcls)->GetQualifiedName().c_str(), 
+			(*pcls)->GetMemberList().GetMemberIndex(), first );
+	fprintf( out, first ? "],\n" : "\n  ],\n" );
+
+	//  
+	const LookupCounter *counters[] = { 
+		&CompilerStatistics::deepSearch, &CompilerStatistics::findSymbol, 
+		&CompilerStatistics::findInScope };
+	PCSTR names[] = { "deepSearch", "findSymbol", "findInScope" };
+
+	fprintf( out, "  \"lookup\": {" );
+	for( int i = 0; i<3; i++ )
+		fprintf( out, "%s\n    \"%s\": { \"calls\": %u, \"hits\": %u }", 
+			i ? "," : "", names[i], counters[i]->calls, counters[i]->hits );
+	fprintf( out, "\n  },\n" );
+
+	fprintf( out, "  \"accessControlChecks\": %u,\n", CompilerStatistics::accessChecks );
+	fprintf( out, "  \"overloadResolutions\": %u,\n", CompilerStatistics::overloadResolutions );
+	fprintf( out, "  \"conversionCache\": { \"calls\": %u, \"hits\": %u },\n",
+		CompilerStatistics::conversionCache.calls, CompilerStatistics::conversionCache.hits );
+	fprintf( out, "  \"overloadIndex\": { \"calls\": %u, \"exactMatches\": %u },\n",
+		CompilerStatistics::exactMatches.calls, CompilerStatistics::exactMatches.hits );
+	fprintf( out, "  \"canonicalTypes\": { \"nodes\": %u, \"types\": %u },\n",
+		CanonicalTypeTable::GetNodeCount(), CanonicalTypeTable::GetTypeCount() );
+	fprintf( out, "  \"packages\": { \"allocations\": %u, \"live\": %u, \"poolBytes\": %u },\n",
+		(unsigned)Package::GetAllocator().GetAllocationCount(), 
+		(unsigned)Package::GetAllocator().GetLiveCount(),
+		(unsigned)Package::GetAllocator().GetArenaBytes() );
+	fprintf( out, "  \"operands\": { \"allocations\": %u, \"live\": %u, \"poolBytes\": %u },\n",
+		(unsigned)Operand::GetAllocator().GetAllocationCount(), 
+		(unsigned)Operand::GetAllocator().GetLiveCount(),
+		(unsigned)Operand::GetAllocator().GetArenaBytes() );
+	fprintf( out, "  \"functionOperands\": { \"allocations\": %u, \"live\": %u, \"poolBytes\": %u },\n",
+		(unsigned)Operand::GetFunctionAllocator().GetAllocationCount(), 
+		(unsigned)Operand::GetFunctionAllocator().GetLiveCount(),
+		(unsigned)Operand::GetFunctionAllocator().GetArenaBytes() );
+	fprintf( out, "  \"semanticArena\": { \"blocks\": %u, \"allocations\": %u, \"bytes\": %u }\n}\n",
+		(unsigned)semanticArena.GetBlockCount(), (unsigned)semanticArena.GetAllocationCount(),
+		(unsigned)semanticArena.GetAllocatedBytes() );
+	fclose(out);
+}
+
+
+//      
+void MemoryStatistics::CapturePhase( PCSTR name )
+{
+	if( !enabled )
+		return;
+
+	phases.push_back( Phase() );
+	phases.back().name = name;
+	memcpy( phases.back().counters, counters, sizeof(counters) );
+}
+
+
+//      JSON
+static void WriteMemoryCounters( FILE *out, const MemoryStatistics::Counter *counters )
+{
+	static PCSTR names[MemoryStatistics::MS_COUNT] = {
+		"lexer", "packages", "identifiers", "symbolTables", 
+		"types", "expressions", "bodies", "translator"
+	};
+
+	for( int i = 0; i<MemoryStatistics::MS_COUNT; i++ )
+		fprintf( out, "%s\n      \"%s\": { \"liveBytes\": %lu, \"peakBytes\": %lu, "
+			"\"allocations\": %lu }", i ? "," : "", names[i], 
+			(unsigned long)counters[i].liveBytes, (unsigned long)counters[i].peakBytes, 
+			(unsigned long)counters[i].allocationCount );
+}
+
+
+//           JSON. 
+//   atexit,    exit,   
+//     
+void MemoryStatistics::Write( PCSTR fname )
+{
+	FILE *out = fopen( fname, "w" );
+	if( out == NULL )
+	{
+		fprintf( stderr, ": '%s' -     \n", fname );
+		return;
+	}
+
+	fprintf( out, "{\n  \"phases\": [" );
+	for( vector<Phase>::iterator p = phases.begin(); p != phases.end(); p++ )
+	{
+		fprintf( out, "%s\n    { \"phase\": ", p == phases.begin() ? "" : "," );
+		WriteJsonString( out, (*p).name.c_str() );
+		fprintf( out, ", \"subsystems\": {" );
+		WriteMemoryCounters( out, (*p).counters );
+		fprintf( out, "\n    } }" );
+	}
+
+	fprintf( out, "\n  ],\n  \"subsystems\": {" );
+	WriteMemoryCounters( out, counters );
+	fprintf( out, "\n  }\n}\n" );
+	fclose(out);
+}
+
+
+//      .   
+//    
+static void WriteMemoryStatistics()
+{
+	MemoryStatistics::CapturePhase("exit");
+	MemoryStatistics::Write("memstats.json");
+}
+
+
+//        
+#define LEX_BENCHMARK_FILE_SIZE		(4 * 1024 * 1024)
+
+
+//  ,   
+static void GenerateNamesFragment( FILE *out, int i )
+{
+	fprintf( out, "static unsigned long counter_%d = base_value_%d + offset_%d * scale_factor;\n"
+		"if( counter_%d < limit_value && !is_ready_%d ) return compute_next( counter_%d );\n", 
+		i, i % 97, i % 13, i, i % 7, i );
+}
+
+
+//      
+static void GenerateStringsFragment( FILE *out, int i )
+{
+	fprintf( out, "const char *message_%d = \"", i );
+	for( int j = 0; j<8; j++ )
+		fprintf( out, "the quick brown fox jumps over the lazy dog \\\"%d\\\" ", j );
+	fprintf( out, "\";\n" );
+}
+
+
+//     
+static void GenerateNumbersFragment( FILE *out, int i )
+{
+	fprintf( out, "{ %d, 0x%XU, 0%o, %d.%de-%d, %d.%dF, '%c', %luL },\n", 
+		i, i * 2654435761U, i, i, i % 1000, i % 30, i % 100, i % 10, 'a' + i % 26, 
+		(unsigned long)i * 100003UL );
+}
+
+
+//    .   ,
+//        ,  
+//      
+static void GenerateCommentsFragment( FILE *out, int i )
+{
+	fprintf( out, "%80s\n%60s\n\n%72s\nint field_%d;%40s\n\n", "", "", "", i, "" );
+}
+
+
+//      
+static void RunLexerBenchmark()
+{
+	static struct 
+	{
+		//    
+		PCSTR title;
+
+		//   
+		void (*generate)( FILE *out, int i );
+	} inputs[] = {
+		"", GenerateNamesFragment,
+		" ", GenerateStringsFragment,
+		" ", GenerateNumbersFragment,
+		"", GenerateCommentsFragment
+	};
+
+	for( int i = 0; i<sizeof(inputs) / sizeof(inputs[0]); i++ )
+	{
+		FILE *tmp = tmpfile();
+		if( !tmp )
+			theApp.Fatal("     ");
+
+		for( int j = 0; ftell(tmp) < LEX_BENCHMARK_FILE_SIZE; j++ )
+			inputs[i].generate(tmp, j);
+		rewind(tmp);
+
+		LexicalAnalyzer la(tmp);
+		LexicalStatistics stat;
+
+		fclose(tmp);
+		stat.Run(la);
+		stat.Print(inputs[i].title);
+	}
+}
+
+
 //    .    
 void ApplicationGenerator::OpenFile( PCSTR fnam )
 {
@@ -145,6 +507,8 @@ void ApplicationGenerator::FlushCurrentBuffer( )
 	if( fputs(currentBuffer.c_str(), fout) == EOF )
 		theApp.Fatal( "     " );
 	currentBuffer = "";
+	MemoryStatistics::Freed( MemoryStatistics::MS_TRANSLATOR, accountedBytes );
+	accountedBytes = 0;
 }
 
 
@@ -171,8 +535,14 @@ void Application::PutMessage( PCSTR head, PCSTR fname, const Position &pos,
 	if( fname )
       	fprintf( stderr, "%s", fname );
 
-	if( pos.col > 0 || pos.line > 0 )
-		fprintf( stderr, "(%d, %d): ", pos.line, pos.col );
+	//        
+	if( pos.IsKnown() && translationUnit != NULL )
+	{
+		unsigned line, col;
+		translationUnit->GetLineAndColumn(pos, line, col);
+		fprintf( stderr, "(%d, %d): ", line, col );
+	}
+
 	else
 		fprintf( stderr, ": " );
 	
@@ -183,6 +553,40 @@ void Application::PutMessage( PCSTR head, PCSTR fname, const Position &pos,
 //     
 void Application::LoadOptions( int argc, char *argv[] )
 {
+	for( int i = 1; i<argc; i++ )
+	{
+		CharString opt = argv[i];
+
+		if( opt == "-lex" )
+			runMode = RM_LEX_ONLY;
+
+		else if( opt == "-lexbench" )
+			runMode = RM_LEX_BENCHMARK;
+
+		else if( opt == "-decl" )
+			runMode = RM_DECLARATIONS_ONLY;
+
+		else if( opt == "-stats" )
+			writeStatistics = true;
+
+		else if( opt == "-stream" )
+			streaming = true;
+
+		//      
+		else if( opt == "-memstats" )
+		{
+			if( !MemoryStatistics::IsEnabled() )
+				atexit( WriteMemoryStatistics );
+			MemoryStatistics::Enable();
+		}
+
+		else if( argv[i][0] == '-' )
+			Fatal( "'%s' -  ", opt.c_str() );
+
+		//    
+		else
+			inFileName = opt;
+	}
 }
 
 
@@ -313,12 +717,31 @@ void Application::Internal( PCSTR msg, PCSTR fname, int line  )
 //  
 int Application::Make()
 {	
-	//     
-	generator.OpenFile("out.txt");
-	translationUnit = new TranslationUnit ("in.txt");		
+	//       
+	if( runMode == RM_LEX_BENCHMARK )
+	{
+		RunLexerBenchmark();
+		return SUCCESS_EXIT_CODE;
+	}
+
+	translationUnit = new TranslationUnit (inFileName.c_str());		
+	MemoryStatistics::CapturePhase("initialization");
+	if( runMode == RM_LEX_ONLY )
+		translationUnit->LexOnly();
+
+	else
+	{
+		//     
+		generator.OpenFile("out.txt");
+		translationUnit->Compile();
+
+		if( writeStatistics )
+			translationUnit->WriteStatistics("stats.json");
+	}
 
-	translationUnit->Compile();
+	MemoryStatistics::CapturePhase("compilation");
 	delete translationUnit;
+	MemoryStatistics::CapturePhase("release");
 
 	return SUCCESS_EXIT_CODE;
 }
@@ -27,15 +27,30 @@
 typedef const char *PCSTR;
 
 
+// ,    
+#define UNKNOWN_POSITION_OFFSET		0xFFFFFFFF
+
+
 //     ,    
-//  
+//  .       
+// ,        
 struct Position
 {
-	// , 
-	unsigned line, col;
+	//    
+	unsigned offset;
 
 	// 
-	Position( unsigned l = 0, unsigned c = 0 ) : line(l), col(c) {
+	Position( unsigned ofs = UNKNOWN_POSITION_OFFSET ) : offset(ofs) {
+	}
+
+	//  true,   
+	bool IsKnown() const {
+		return offset != UNKNOWN_POSITION_OFFSET;
+	}
+
+	//  
+	bool operator==( const Position &pos ) const {
+		return offset == pos.offset;
 	}
 };
 
@@ -55,19 +70,157 @@ class ClassType;
 class Identifier;
 
 
+//        
+struct LookupCounter
+{
+	//  
+	unsigned calls;
+
+	//   
+	unsigned hits;
+
+	//     found,  found
+	bool Count( bool found ) {
+		calls++;
+		if( found )
+			hits++;
+		return found;
+	}
+};
+
+
+//    ,    -stats
+class CompilerStatistics
+{
+public:
+	//  , Scope::DeepSearch
+	static LookupCounter deepSearch;
+
+	//     , SymbolTable::FindSymbol
+	static LookupCounter findSymbol;
+
+	//     , SymbolTable::FindInScope
+	static LookupCounter findInScope;
+
+	//   , AccessControlChecker
+	static unsigned accessChecks;
+
+	//   , OverloadResolutor
+	static unsigned overloadResolutions;
+
+	//     , AutoCastManager
+	static LookupCounter conversionCache;
+
+	//       
+	//  , OverloadResolutor
+	static LookupCounter exactMatches;
+};
+
+
+//     ,   -memstats.
+//         
+// new  delete  .    ,    
+class MemoryStatistics
+{
+public:
+	// ,    
+	enum Subsystem {
+		MS_LEXER,			//    
+		MS_PACKAGES,		//   
+		MS_IDENTIFIERS,		// 
+		MS_SYMBOL_TABLES,	// -  
+		MS_TYPES,			//     
+		MS_EXPRESSIONS,		//  
+		MS_BODIES,			//     
+		MS_TRANSLATOR,		//  
+		MS_COUNT
+	};
+
+	//   
+	struct Counter
+	{
+		//      
+		size_t liveBytes, peakBytes;
+
+		//  
+		size_t allocationCount;
+	};
+
+private:
+	//     
+	struct Phase
+	{
+		//  
+		CharString name;
+
+		//  
+		Counter counters[MS_COUNT];
+	};
+
+	// true,   
+	static bool enabled;
+
+	//  
+	static Counter counters[MS_COUNT];
+
+	//    
+	static vector<Phase> phases;
+
+public:
+	//  
+	static void Enable() {
+		enabled = true;
+	}
+
+	//  true,   
+	static bool IsEnabled() {
+		return enabled;
+	}
+
+	//    
+	static void Allocated( Subsystem ss, size_t sz ) {
+		if( enabled )
+		{
+			Counter &c = counters[ss];
+			c.allocationCount++;
+			if( (c.liveBytes += sz) > c.peakBytes )
+				c.peakBytes = c.liveBytes;
+		}
+	}
+
+	//    . , 
+	//   ,  
+	static void Freed( Subsystem ss, size_t sz ) {
+		if( enabled )
+			counters[ss].liveBytes -= sz < counters[ss].liveBytes ? sz : counters[ss].liveBytes;
+	}
+
+	//   
+	static const Counter &GetCounter( Subsystem ss ) {
+		return counters[ss];
+	}
+
+	//      
+	static void CapturePhase( PCSTR name );
+
+	//           JSON
+	static void Write( PCSTR fname );
+};
+
+
 //  
 class TranslationUnit
 {
+	//      . 
+	// ,      
+	NRC::Arena semanticArena;
+
 	//   
 	CharString fileName;
 
 	//  ,   
 	CharString shortFileName;
 
-	//    
-	Position currentPos;
-
-
 	//    
 	FILE *inStream;
 
@@ -86,6 +239,9 @@ class TranslationUnit
 	//   .  new, new[], delete, delete[]
 	void MakeImplicitDefinations();
 
+	//   ,     
+	static void ResetStaticCaches();
+
 public:
 
 	//      
@@ -97,8 +253,17 @@ public:
 	//   
 	void Compile();
 
+	//        
+	void LexOnly();
+
+	//           JSON
+	void WriteStatistics( PCSTR fname ) const;
+
 	//   
-	Position GetPosition() const { return currentPos; }
+	Position GetPosition() const;
+
+	//        
+	void GetLineAndColumn( const Position &pos, unsigned &line, unsigned &col ) const;
 
 
 	//   
@@ -107,6 +272,11 @@ public:
 	//    
 	const CharString &GetShortFileName() const { return shortFileName; }
 
+	//     
+	const NRC::Arena &GetSemanticArena() const {
+		return semanticArena;
+	}
+
 	//     
 	const Scope &GetScopeSystem() const {
 		return *scope;
@@ -131,10 +301,13 @@ class ApplicationGenerator
 	//    
 	FILE *fout;
 
+	//   ,    
+	size_t accountedBytes;
+
 public:
 	//  .    
 	ApplicationGenerator( ) 
-		: fout(NULL) {
+		: fout(NULL), accountedBytes(0) {
 	}
 
 	//  
@@ -149,6 +322,8 @@ public:
 	//    
 	void GenerateToCurrentBuffer( const string &buf ) {
 		currentBuffer += buf;
+		accountedBytes += buf.length();
+		MemoryStatistics::Allocated( MemoryStatistics::MS_TRANSLATOR, buf.length() );
 	}
 
 	//    
@@ -167,9 +342,34 @@ public:
 // 
 class Application
 {
+public:
+	//   ,    
+	enum RunMode {
+		RM_COMPILE,				//  
+		RM_LEX_ONLY,			//   ,  -lex
+		RM_LEX_BENCHMARK,		//     
+								//  ,  -lexbench
+		RM_DECLARATIONS_ONLY	//   ,  
+								// ,  -decl
+	};
+
+private:
 	//  cpp-  
 	TranslationUnit *translationUnit;
 
+	//   
+	CharString inFileName;
+
+	//  
+	RunMode runMode;
+
+	//      ,  -stats
+	bool writeStatistics;
+
+	//          
+	//  ,  -stream
+	bool streaming;
+
 	//  .     
 	//    
 	ApplicationGenerator generator;
@@ -186,7 +386,9 @@ class Application
 public:
 	// 
 	Application()
-		: translationUnit(NULL), errcount(0), warncount(0), startTime( clock() ){		
+		: translationUnit(NULL), inFileName("in.txt"), runMode(RM_COMPILE), 
+		writeStatistics(false), streaming(false), errcount(0), warncount(0), 
+		startTime( clock() ){		
 	} 
 
 	//     
@@ -211,6 +413,21 @@ public:
 		return errcount > 0;
 	}
 
+	//    
+	int GetErrorCount() const {
+		return errcount;
+	}
+
+	//     ,  ,  true
+	bool IsDeclarationsOnly() const {
+		return runMode == RM_DECLARATIONS_ONLY;
+	}
+
+	//       ,  true
+	bool IsStreaming() const {
+		return streaming;
+	}
+
 	//     
 	void LoadOptions( int argc, char *argv[] );
 
@@ -23,6 +23,27 @@ using namespace NRC;
 POperand ErrorOperand::errorOperand = NULL;
 
 
+//   .   , .. 
+//     
+NRC::FreeListAllocator &Operand::GetAllocator()
+{
+	static NRC::FreeListAllocator *allocator = new NRC::FreeListAllocator;
+	return *allocator;
+}
+
+
+//     
+NRC::FreeListAllocator &Operand::GetFunctionAllocator()
+{
+	static NRC::FreeListAllocator *allocator = new NRC::FreeListAllocator;
+	return *allocator;
+}
+
+
+//   ,      
+int Operand::functionPoolDepth = 0;
+
+
 //    
 ObjectInitializator::~ObjectInitializator() { }
 BodyComponent::~BodyComponent() { }
@@ -39,6 +60,131 @@ Parametr::~Parametr()
 }
 
 
+//  ,       
+//  ,     
+static void DeleteOwnedComponent( const BodyComponent *bc );
+
+
+//   ,    
+//  .     
+// ,        
+static void ReleaseOwnedComponents( const BodyComponent &bc )
+{
+	//      
+	if( bc.GetComponentID() == BodyComponent::BCC_LABEL )
+	{
+		DeleteOwnedComponent( 
+			&static_cast<const LabelBodyComponent &>(bc).GetNextComponent() );
+		return;
+	}
+
+	if( bc.GetComponentID() != BodyComponent::BCC_CONSTRUCTION )
+		return;
+
+	const Construction &cc = static_cast<const Construction &>(bc);
+	if( cc.GetConstructionID() == Construction::CC_COMPOUND )
+	{
+		const BodyComponentList &bcl = 
+			static_cast<const CompoundConstruction &>(cc).GetBodyComponentList();
+		for( BodyComponentList::const_iterator p = bcl.begin(); p != bcl.end(); p++ )
+			ReleaseOwnedComponents(**p);
+		return;
+	}
+
+	DeleteOwnedComponent( cc.GetChildComponent() );
+
+	// if  else-, try - 
+	if( cc.GetConstructionID() == Construction::CC_IF )
+		DeleteOwnedComponent( static_cast<const IfConstruction &>(cc).GetElseConstruction() );
+
+	else if( cc.GetConstructionID() == Construction::CC_TRY )
+	{
+		const CatchConstructionList &ccl = 
+			static_cast<const TryCatchConstruction &>(cc).GetCatchList();
+		for( CatchConstructionList::const_iterator p = ccl.begin(); p != ccl.end(); p++ )
+			DeleteOwnedComponent( *p );
+	}
+}
+
+
+//       
+static void DeleteOwnedComponent( const BodyComponent *bc )
+{
+	if( bc == NULL )
+		return;
+
+	ReleaseOwnedComponents(*bc);
+	delete const_cast<BodyComponent *>(bc);
+}
+
+
+//     catch-    
+static void CollectCatchObjects( const BodyComponent *bc, vector<const Identifier *> &out )
+{
+	if( bc == NULL )
+		return;
+
+	if( bc->GetComponentID() == BodyComponent::BCC_LABEL )
+	{
+		CollectCatchObjects( 
+			&static_cast<const LabelBodyComponent *>(bc)->GetNextComponent(), out );
+		return;
+	}
+
+	if( bc->GetComponentID() != BodyComponent::BCC_CONSTRUCTION )
+		return;
+
+	const Construction &cc = *static_cast<const Construction *>(bc);
+	if( cc.GetConstructionID() == Construction::CC_COMPOUND )
+	{
+		const BodyComponentList &bcl = 
+			static_cast<const CompoundConstruction &>(cc).GetBodyComponentList();
+		for( BodyComponentList::const_iterator p = bcl.begin(); p != bcl.end(); p++ )
+			CollectCatchObjects(&**p, out);
+		return;
+	}
+
+	CollectCatchObjects( cc.GetChildComponent(), out );
+	if( cc.GetConstructionID() == Construction::CC_IF )
+		CollectCatchObjects( static_cast<const IfConstruction &>(cc).GetElseConstruction(), out );
+
+	else if( cc.GetConstructionID() == Construction::CC_TRY )
+	{
+		const CatchConstructionList &ccl = 
+			static_cast<const TryCatchConstruction &>(cc).GetCatchList();
+		for( CatchConstructionList::const_iterator p = ccl.begin(); p != ccl.end(); p++ )
+			CollectCatchObjects( *p, out );
+	}
+
+	else if( cc.GetConstructionID() == Construction::CC_CATCH )
+	{
+		const PTypyziedEntity &ct = static_cast<const CatchConstruction &>(cc).GetCatchType();
+		if( !ct.IsNull() )
+			if( const Identifier *id = dynamic_cast<const Identifier *>(&*ct) )
+				out.push_back(id);
+	}
+}
+
+
+//   catch- 
+void FunctionBody::GetCatchObjects( vector<const Identifier *> &out ) const
+{
+	CollectCatchObjects(construction, out);
+}
+
+
+//    
+void FunctionBody::ReleaseBody()
+{
+	if( construction == NULL )
+		return;
+
+	ReleaseOwnedComponents(*construction);
+	delete construction;
+	construction = NULL;
+}
+
+
 //  ,   
 ConstructorFunctionBody::ConstructorFunctionBody( const Function &pFn, const Position &ccPos )
 	: FunctionBody(pFn, ccPos), oieList(new ObjectInitElementList)
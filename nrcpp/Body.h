@@ -10,37 +10,101 @@ typedef list<ObjectInitElement> ObjectInitElementList;
 
 //  ,      . 
 //  ,       . 
-class Operand
+//       
+class Operand : public NRC::RefCounted
 {
+public:
+	//  
+	enum OK { OK_EXPRESSION, OK_PRIMARY, OK_TYPE, OK_OVERLOAD, OK_ERROR };
+
+private:
+	//  ,   . 
+	//      
+	OK operandKind;
+
+protected:
+	//     
+	Operand( OK ok ) : operandKind(ok) {
+	}
+
 public:
 
 	//    
 	virtual ~Operand() {
 	}
 
+	//    .     
+	//    ,    
+	//  .      , 
+	//        
+	static NRC::FreeListAllocator &GetAllocator();
+
+	//     .    
+	//      ,   
+	//   .      
+	static NRC::FreeListAllocator &GetFunctionAllocator();
+
+	//    ,   
+	//     
+	static int functionPoolDepth;
+
+	//       
+	static void BeginFunctionPool() {
+		functionPoolDepth++;
+	}
+
+	//    .     
+	// ,       
+	static void EndFunctionPool() {
+		if( --functionPoolDepth == 0 )
+			GetFunctionAllocator().Reset();
+	}
+
+	//      
+	static void *operator new( size_t sz ) {
+		MemoryStatistics::Allocated( MemoryStatistics::MS_EXPRESSIONS, sz );
+		if( functionPoolDepth > 0 && sz <= NRC::FreeListAllocator::MAX_SMALL_SIZE )
+			return GetFunctionAllocator().Allocate(sz);
+		return GetAllocator().Allocate(sz);
+	}
+
+	//     ,    
+	static void operator delete( void *p, size_t sz ) {
+		MemoryStatistics::Freed( MemoryStatistics::MS_EXPRESSIONS, sz );
+		if( sz <= NRC::FreeListAllocator::MAX_SMALL_SIZE && GetFunctionAllocator().Owns(p) )
+			GetFunctionAllocator().Free(p, sz);
+		else
+			GetAllocator().Free(p, sz);
+	}
+
+	//   
+	OK GetOperandKind() const {
+		return operandKind;
+	}
+
 	//    
-	virtual bool IsTypeOperand() const {
-		return false;
+	bool IsTypeOperand() const {
+		return operandKind == OK_TYPE;
 	}
 
 	//     (,   )
-	virtual bool IsExpressionOperand() const {
-		return false;
+	bool IsExpressionOperand() const {
+		return operandKind == OK_EXPRESSION;
 	}
 
 	//     (, , true, false, this)
-	virtual bool IsPrimaryOperand() const {
-		return false;
+	bool IsPrimaryOperand() const {
+		return operandKind == OK_PRIMARY;
 	}
 
 	//      
-	virtual bool IsOverloadOperand() const {
-		return false;
+	bool IsOverloadOperand() const {
+		return operandKind == OK_OVERLOAD;
 	}
 
 	//    
-	virtual bool IsErrorOperand() const {
-		return false;
+	bool IsErrorOperand() const {
+		return operandKind == OK_ERROR;
 	}
 
 	//   .  OverloadOperand  IsErrorOperand,
@@ -111,16 +175,12 @@ protected:
 
 	//      
 	Expression( int opCnt, int opCode, bool lv ) 
-		: operandCount(opCnt), operatorCode(opCode), lvalue(lv), inCramps(false) {
+		: Operand(OK_EXPRESSION), operandCount(opCnt), operatorCode(opCode), 
+		  lvalue(lv), inCramps(false) {
 	}
 
 public:
 
-	//     (,   )
-	bool IsExpressionOperand() const {
-		return true;
-	}
-
 	//    
 	bool IsUnary() const {
 		return operandCount == 1;
@@ -300,7 +360,9 @@ class FunctionCallExpression : public Expression
 	// TypeOperand.        
 	POperand pFunction;
 
-	//   ,   
+	//   ,   .    
+	//       ,
+	//     ,     
 	PExpressionList parametrList;
 
 	//   
@@ -387,7 +449,7 @@ class ErrorOperand : public Operand
 
 	//     
 	//   
-	ErrorOperand() { }
+	ErrorOperand() : Operand(OK_ERROR) { }
 
 	//    Operand.   
 	const TypyziedEntity &GetType() const {
@@ -397,11 +459,6 @@ class ErrorOperand : public Operand
 
 public:
 
-	//    
-	bool IsErrorOperand() const {
-		return true;
-	}
-
 	//    
 	static const POperand &GetInstance() {
 		if( errorOperand.IsNull() )
@@ -427,7 +484,7 @@ class PrimaryOperand : public Operand
 public:
 	//    
 	PrimaryOperand( bool lv, const TypyziedEntity &pt )
-		: lvalue(lv), pType(pt) {
+		: Operand(OK_PRIMARY), lvalue(lv), pType(pt) {
 	}
 
 	//  ,   ,
@@ -438,11 +495,6 @@ public:
 			delete &pType;		
 	}
 
-	//     (, , true, false, this)
-	bool IsPrimaryOperand() const {
-		return true;
-	}
-
 	//    lvalue
 	bool IsLvalue() const {
 		return lvalue;
@@ -469,7 +521,7 @@ class TypeOperand : public Operand
 public:
 	//    
 	TypeOperand( const TypyziedEntity &pt )
-		: pType(pt) {
+		: Operand(OK_TYPE), pType(pt) {
 	}
 
 	//    . 
@@ -478,11 +530,6 @@ public:
 		delete &pType;
 	}
 
-	//    
-	bool IsTypeOperand() const {
-		return true;
-	}
-
 	//   
 	const TypyziedEntity &GetType() const {
 		return pType;
@@ -518,7 +565,7 @@ public:
 
 	//    
 	OverloadOperand( const OverloadFunctionList &ovl )
-		:   overloadList(ovl), lvalue(true)  {		
+		:   Operand(OK_OVERLOAD), overloadList(ovl), lvalue(true)  {		
 	}
 
 	//  rvalue
@@ -526,11 +573,6 @@ public:
 		return lvalue;
 	}
 
-	//      
-	bool IsOverloadOperand() const {
-		return true;
-	}
-
 	//    
 	const OverloadFunctionList &GetOverloadList() const {
 		return overloadList;
@@ -753,7 +795,7 @@ public:
 //     
 //
 //      
-class BodyComponent
+class BodyComponent : public NRC::RefCounted
 {
 public:
 	//    
@@ -775,6 +817,18 @@ public:
 	//     
 	virtual ~BodyComponent() = 0;
 
+	//         
+	static void *operator new( size_t sz ) {
+		MemoryStatistics::Allocated( MemoryStatistics::MS_BODIES, sz );
+		return ::operator new(sz);
+	}
+
+	//   
+	static void operator delete( void *p, size_t sz ) {
+		MemoryStatistics::Freed( MemoryStatistics::MS_BODIES, sz );
+		::operator delete(p);
+	}
+
 	//  
 	const Position &GetPosition() const {
 		return errPos;
@@ -1621,9 +1675,32 @@ public:
 	}
 
 	//   
-	~FunctionBody() {
+	virtual ~FunctionBody() {
 		delete construction;
 	}
+
+	//    .   
+	//    ,     -  
+	//  ,     . 
+	//   ,   
+	void ReleaseBody();
+
+	//   catch- .   catch-
+	//   ,     
+	//    
+	void GetCatchObjects( vector<const Identifier *> &out ) const;
+
+	//         
+	static void *operator new( size_t sz ) {
+		MemoryStatistics::Allocated( MemoryStatistics::MS_BODIES, sz );
+		return ::operator new(sz);
+	}
+
+	//   
+	static void operator delete( void *p, size_t sz ) {
+		MemoryStatistics::Freed( MemoryStatistics::MS_BODIES, sz );
+		::operator delete(p);
+	}
 		
 	//  ,    ConstructorFunctionBody
 	virtual bool IsConstructorBody() const {
@@ -154,7 +154,7 @@ bool BodyMakerUtils::MakeLocalSymbolTable( const Construction &cur )
 		cur.GetConstructionID() == Construction::CC_DOWHILE )
 		return false;
 
-	GetScopeSystem().MakeNewSymbolTable( new LocalSymbolTable(GetCurrentSymbolTable()) );
+	GetScopeSystem().MakeNewSymbolTable( LocalSymbolTable::Create(GetCurrentSymbolTable()) );
 	return true;
 }
 
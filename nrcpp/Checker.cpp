@@ -511,6 +511,11 @@ void CheckerUtils::DefaultArgumentCheck( const FunctionPrototype &declFn,
 				break;
 			}
 		}
+
+		//        ,
+		//       
+		if( haveDP )
+			Parametr::IncreaseDefaultValueGeneration();
 	}
 }
 
@@ -1652,6 +1657,9 @@ bool AccessControlChecker::DerivedFrom( const ClassType &d, const ClassType &b )
 	if( &d == &b )
 		return true;
 
+	if( const ClassHierarchyIndex *hix = d.GetHierarchyIndex() )
+		return hix->FindBase(b) != NULL;
+
 	register const BaseClassList &dbcl = d.GetBaseClassList();
 	for( int i = 0; i<dbcl.GetBaseClassCount(); i++ )
 		if( DerivedFrom( dbcl.GetBaseClassCharacteristic(i)->GetPointerToClass(), b ) )
@@ -1661,14 +1669,108 @@ bool AccessControlChecker::DerivedFrom( const ClassType &d, const ClassType &b )
 }
 
 
-//  ,     
+//       
+map<AccessControlChecker::InheritedAccessKey, AccessControlChecker::InheritedAccess> 
+	AccessControlChecker::inheritedAccessTable;
+
+
+//    
+map<AccessControlChecker::DecisionKey, AccessControlChecker::Decision> 
+	AccessControlChecker::decisionCache;
+
+
+//     ,   
+//  memberCls
+void AccessControlChecker::GetRealAccessSpecifier( RealAccessSpecifier &ras )
+{
+	//    ,     
+	if( memberCls.IsUncomplete() )
+	{
+		AnalyzeClassHierarhy( ras, member.GetAccessSpecifier(), memberCls, 0);
+		return;
+	}
+
+	InheritedAccessKey key(&memberCls, ras.pClass);
+	map<InheritedAccessKey, InheritedAccess>::iterator p = inheritedAccessTable.find(key);
+
+	//       
+	if( p == inheritedAccessTable.end() )
+	{
+		InheritedAccess ia;
+		ia.realAs[ClassMember::NOT_CLASS_MEMBER] = ClassMember::NOT_CLASS_MEMBER;
+		for( int as = ClassMember::AS_PRIVATE; as <= ClassMember::AS_PUBLIC; as++ )
+		{
+			RealAccessSpecifier r((ClassMember::AS)as, &member);
+			AnalyzeClassHierarhy( r, (ClassMember::AS)as, memberCls, 0);
+			ia.realAs[as] = r.realAs;
+			ia.isClassFound = r.isClassFound;
+		}
+
+		p = inheritedAccessTable.insert( 
+			map<InheritedAccessKey, InheritedAccess>::value_type(key, ia) ).first;
+	}
+
+	ras.realAs = (*p).second.realAs[member.GetAccessSpecifier()];
+	ras.isClassFound = (*p).second.isClassFound;
+}
+
+
+//  ,     ,
+//    ,   
 void AccessControlChecker::Check()
 {
 	INTERNAL_IF( member.GetAccessSpecifier() == ClassMember::NOT_CLASS_MEMBER );
 
 	//       
 	INTERNAL_IF( curST.IsLocalSymbolTable() );
+	CompilerStatistics::accessChecks++;
 
+	// ,   .   
+	//       
+	DecisionKey key;
+	const ClassType *accessCls = NULL;
+	if( curST.IsFunctionSymbolTable() )
+	{
+		const Function &fn = static_cast<const FunctionSymbolTable &>(curST).GetFunction();
+		key.accessor = &fn;
+		if( fn.IsClassMember() )
+			accessCls = static_cast<const ClassType*>(&fn.GetSymbolTableEntry());
+	}
+
+	else if( curST.IsClassSymbolTable() )
+		key.accessor = accessCls = static_cast<const ClassType *>(&curST);
+	else
+		key.accessor = NULL;
+
+	if( memberCls.IsUncomplete() || (accessCls && accessCls->IsUncomplete()) )
+	{
+		CheckAccess();
+		return;
+	}
+
+	key.memberCls = &memberCls;
+	key.member = &member;
+	const ClassType &owner = static_cast<const ClassType &>(
+		dynamic_cast<const Identifier &>(member).GetSymbolTableEntry());
+	int friendCount = owner.GetFriendList().GetClassFriendCount();
+
+	map<DecisionKey, Decision>::iterator p = decisionCache.find(key);
+	if( p != decisionCache.end() && (*p).second.friendCount == friendCount )
+	{
+		accessible = (*p).second.accessible;
+		return;
+	}
+
+	CheckAccess();
+	Decision &d = decisionCache[key];
+	d.accessible = accessible;
+	d.friendCount = friendCount;
+}
+
+
+//      
+void AccessControlChecker::CheckAccess()
+{
 	//         ,
 	//      member  memberCls
 	RealAccessSpecifier ras(member.GetAccessSpecifier(), &member) ;
@@ -1677,7 +1779,7 @@ void AccessControlChecker::Check()
 	//  ,           , 
 	//     .      ,
 	// isClassFound   0
-	AnalyzeClassHierarhy( ras, member.GetAccessSpecifier(), memberCls, 0);	
+	GetRealAccessSpecifier(ras);
 
 	//       .
 	//       , 
@@ -1792,7 +1894,7 @@ void AccessControlChecker::Check()
 
 	//  
 	else
-		INTERNAL( "'AccessControlChecker::Check'    " );
+		INTERNAL( "'AccessControlChecker::CheckAccess'    " );
 }
 
 
@@ -406,9 +406,13 @@ class AccessControlChecker
 	//   true,   
 	bool accessible;
 
-	//  ,     
+	//  ,     ,
+	//    ,   
 	void Check();
 
+	//      
+	void CheckAccess();
+
 public:
 
 	//      ,    
@@ -424,6 +428,13 @@ public:
 		return accessible;
 	}
 
+	//       , 
+	//    , ..    
+	static void ClearCache() {
+		decisionCache.clear();
+		inheritedAccessTable.clear();
+	}
+
 private:
 
 	//  ,   
@@ -469,6 +480,68 @@ private:
 	
 	//   true,  d    b
 	bool DerivedFrom( const ClassType &d, const ClassType &b );
+
+	//     ,   
+	//  memberCls.     
+	//     
+	void GetRealAccessSpecifier( RealAccessSpecifier &ras );
+
+	//      owner  
+	//    ,    
+	// AS_PRIVATE, AS_PROTECTED, AS_PUBLIC,   owner
+	struct InheritedAccess
+	{
+		//  ,  -  
+		ClassMember::AS realAs[ClassMember::AS_PUBLIC + 1];
+
+		// true,  owner   
+		bool isClassFound;
+	};
+
+	//    : ,  
+	//  ,  ,   
+	typedef pair<const ClassType *, const ClassType *> InheritedAccessKey;
+
+	//       
+	static map<InheritedAccessKey, InheritedAccess> inheritedAccessTable;
+
+	//   
+	struct DecisionKey
+	{
+		//   ,    ,  NULL,
+		//        
+		const Identifier *accessor;
+
+		//       
+		const ClassType *memberCls;
+
+		//  
+		const ClassMember *member;
+
+		//     map
+		bool operator<( const DecisionKey &k ) const {
+			if( accessor != k.accessor )
+				return accessor < k.accessor;
+			if( memberCls != k.memberCls )
+				return memberCls < k.memberCls;
+			return member < k.member;
+		}
+	};
+
+	//    
+	struct Decision
+	{
+		//  
+		bool accessible;
+
+		//        . 
+		//       ,
+		//     
+		int friendCount;
+	};
+
+	//    
+	static map<DecisionKey, Decision> decisionCache;
 };
 
 
@@ -44,18 +44,6 @@ int ClassFriendList::FindClassFriend( const Identifier *p ) const
 }
 
 
-//      name    ,
-//    ,   
-IdentifierList *ClassMemberList::FindMember( const CharString &name ) const
-{
-	ListOfIdentifierList::iterator p = 
-		find_if( memberList.begin(), memberList.end(), IdentifierListFunctor(name) );
-	if( p != memberList.end() )
-		return &*p;
-	return NULL;
-}
-
-
 //    .     
 //   ,  ,   ,  
 //    
@@ -65,23 +53,12 @@ void ClassMemberList::AddClassMember( PClassMember cm )
 	//     
 	INTERNAL_IF( (id = dynamic_cast<Identifier *>(&*cm)) == NULL );
 
-	if( IdentifierList *il = FindMember( id->GetName() ) )
-	{
-		il->push_back(id);
-
-		//   - ,    ,
-		//      -
-		if( !id->GetC_Name().empty() )
-			const_cast<string &>(id->GetC_Name()) += CharString((int)il->size()).c_str();
-	}
+	unsigned icnt = memberIndex.Insert(id);
 
-	else
-	{
-		//     
-		IdentifierList newil;
-		newil.push_back(id);
-		memberList.push_back(newil);
-	}
+	//   - ,    ,
+	//      -
+	if( icnt > 1 && !id->GetC_Name().empty() )
+		const_cast<string &>(id->GetC_Name()) += CharString((int)icnt).c_str();
 	
 	//        
 	//     
@@ -94,7 +71,7 @@ void ClassMemberList::ClearMemberList()
 {
 	//      
 	order.clear();
-	memberList.clear();
+	memberIndex.Clear();
 }
 
 
@@ -104,16 +81,109 @@ ClassType::ClassType( const NRC::CharString &name, SymbolTable *entry, BT bt, AS
 	Identifier( (name[0] == '<' ? TranslatorUtils::GenerateUnnamed().c_str() : name), entry), 
 	BaseType(bt), accessSpecifier(as), uncomplete(true), polymorphic(false), madeVmTable(false),
 	abstractMethodCount(0), virtualMethodCount(0), castOperatorList(NULL),
-	destructor(NULL), virtualFunctionList(NULL)
+	destructor(NULL), virtualFunctionList(NULL), baseLookupCache(NULL), hierarchyIndex(NULL)
 {
 	c_name = ( "__" + TranslatorUtils::GenerateScopeName(*entry) + GetName().c_str() );
 }
 
 
+//   
+unsigned ClassHierarchyIndex::classCounter = 0;
+
+
+//      .  
+//          , 
+//      
+ClassHierarchyIndex::ClassHierarchyIndex( const BaseClassList &bcl )
+	: classId(classCounter++)
+{
+	for( int i = 0; i<bcl.GetBaseClassCount(); i++ )
+	{
+		const BaseClassCharacteristic &bcc = *bcl.GetBaseClassCharacteristic(i);
+		const ClassType &bcls = bcc.GetPointerToClass();
+		const ClassHierarchyIndex *bix = bcls.GetHierarchyIndex();
+		INTERNAL_IF( bix == NULL );
+
+		bool pub = bcc.GetAccessSpecifier() == ClassMember::AS_PUBLIC;
+		string prefix = bcls.GetC_Name() + "so" + (bcc.IsVirtualDerivation() ? "->" : ".");
+
+		//   
+		BaseEntry be;
+		be.classId = bix->classId;
+		be.pClass = &bcls;
+		be.pathCount = 1;
+		be.virtualDerivation = bcc.IsVirtualDerivation();
+		be.accessible = pub;
+		be.path = prefix;
+		baseEntries.push_back(be);
+
+		//    
+		for( vector<BaseEntry>::const_iterator p = bix->baseEntries.begin();
+			 p != bix->baseEntries.end(); p++ )
+		{
+			be = *p;
+			be.accessible = pub && (*p).accessible;
+			be.path = prefix + (*p).path;
+			baseEntries.push_back(be);
+		}
+	}
+
+	//    ,    
+	// .  ,    ,
+	//        
+	stable_sort(baseEntries.begin(), baseEntries.end());
+	vector<BaseEntry>::iterator out = baseEntries.begin();
+	for( vector<BaseEntry>::iterator p = baseEntries.begin(); p != baseEntries.end(); p++ )
+	{
+		if( p != baseEntries.begin() && (*(out-1)).classId == (*p).classId )
+		{
+			BaseEntry &prev = *(out-1);
+			prev.pathCount += (*p).pathCount;
+			prev.virtualDerivation = prev.virtualDerivation && (*p).virtualDerivation;
+			prev.accessible = prev.accessible || (*p).accessible;
+		}
+
+		else
+		{
+			if( out != p )
+				*out = *p;
+			out++;
+		}
+	}
+
+	baseEntries.erase(out, baseEntries.end());
+}
+
+
+//    ,    
+// ,  NULL
+const ClassHierarchyIndex::BaseEntry *ClassHierarchyIndex::FindBase( 
+	const ClassType &base ) const
+{
+	if( base.GetHierarchyIndex() == NULL )
+		return NULL;
+
+	BaseEntry key;
+	key.classId = base.GetHierarchyIndex()->classId;
+	vector<BaseEntry>::const_iterator p = 
+		lower_bound(baseEntries.begin(), baseEntries.end(), key);
+	return p != baseEntries.end() && (*p).classId == key.classId ? &*p : NULL;
+}
+
+
+//   ,     
+void ClassType::MakeHierarchyIndex()
+{
+	INTERNAL_IF( uncomplete || hierarchyIndex != NULL );
+	hierarchyIndex = new ClassHierarchyIndex(baseClassList);
+}
+
+
 //   
 void ClassType::AddBaseClass( const PBaseClassCharacteristic &bcc ) 
 {
 	baseClassList.AddBaseClassCharacteristic(bcc);
+	IncreaseGeneration();
 	virtualMethodCount += bcc->GetPointerToClass().virtualMethodCount;
 
 	//    
@@ -135,32 +205,77 @@ bool ClassType::FindSymbol( const NRC::CharString &name, IdentifierList &out ) c
 {	
 	//      ,    
 	//          
-	if( IdentifierList *il = (memberList).FindMember(name) )
+	if( const IdentifierVector *il = memberList.FindMember(name) )
 	{
 		out.insert( out.end(), il->begin(), il->end() );
-		return true;
+		return CompilerStatistics::findSymbol.Count(true);
 	}
 	
 	//    ,     
 	//      
-	StringList tempList;
+	if( baseClassList.IsEmpty() )
+		return CompilerStatistics::findSymbol.Count(!out.empty());
+
+	//     ,   ,
+	//    
+	vector<const ClassType *> virtualBases;
+	if( uncomplete )
+	{
+		FindInBaseClasses(name, out, virtualBases);
+		return CompilerStatistics::findSymbol.Count(!out.empty());
+	}
+
+	if( baseLookupCache == NULL )
+		baseLookupCache = new map<string, IdentifierList>;
+
+	map<string, IdentifierList>::iterator p = baseLookupCache->find(name);
+	if( p == baseLookupCache->end() )
+	{
+		p = baseLookupCache->insert( 
+			map<string, IdentifierList>::value_type(name, IdentifierList()) ).first;
+		FindInBaseClasses(name, p->second, virtualBases);
+	}
+
+	out.insert( out.end(), p->second.begin(), p->second.end() );
+	return CompilerStatistics::findSymbol.Count(!out.empty());	
+}
+
+
+//      ,  . 
+//  ,     ,   
+void ClassType::FindInBaseClasses( const NRC::CharString &name, IdentifierList &out,
+		vector<const ClassType *> &virtualBases ) const
+{
 	for( int i = 0; i<baseClassList.GetBaseClassCount(); i++ )	
-		baseClassList[i]->GetPointerToClass().FindSymbol(name, out);
-	
-	return !out.empty();	
+	{
+		const BaseClassCharacteristic &bcc = *baseClassList[i];
+		const ClassType &base = bcc.GetPointerToClass();
+		if( bcc.IsVirtualDerivation() )
+		{
+			if( find(virtualBases.begin(), virtualBases.end(), &base) != virtualBases.end() )
+				continue;
+			virtualBases.push_back(&base);
+		}
+
+		//         
+		if( const IdentifierVector *il = base.memberList.FindMember(name) )
+			out.insert( out.end(), il->begin(), il->end() );
+		else
+			base.FindInBaseClasses(name, out, virtualBases);
+	}
 }
 
 
 //    ,    
 bool ClassType::FindInScope( const NRC::CharString &name, IdentifierList &out ) const
 {
-	if( IdentifierList *il = (memberList).FindMember(name) )
+	if( const IdentifierVector *il = memberList.FindMember(name) )
 	{
 		out.insert( out.end(), il->begin(), il->end() );
-		return true;
+		return CompilerStatistics::findInScope.Count(true);
 	}
 	else
-		return false;	
+		return CompilerStatistics::findInScope.Count(false);	
 }
 
 
@@ -170,6 +285,11 @@ bool ClassType::InsertSymbol( Identifier *id )
 	ClassMember *cm = dynamic_cast<ClassMember *>(id);
 	INTERNAL_IF( cm == NULL );
 	memberList.AddClassMember( cm );
+	IncreaseGeneration();
+
+	//       
+	if( baseLookupCache != NULL )
+		baseLookupCache->clear();
 	
 	//    , ,   
 	//    
@@ -200,4 +320,7 @@ bool ClassType::InsertSymbol( Identifier *id )
 void ClassType::ClearTable()
 {
 	memberList.ClearMemberList();
+	IncreaseGeneration();
+	if( baseLookupCache != NULL )
+		baseLookupCache->clear();
 }
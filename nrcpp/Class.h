@@ -256,23 +256,93 @@ public:
 };
 
 
+//   .      
+//        (  ), 
+//    ,    
+//   ,   
+class ClassHierarchyIndex
+{
+public:
+	//       
+	struct BaseEntry
+	{
+		//   
+		unsigned classId;
+
+		//   
+		const ClassType *pClass;
+
+		//       
+		int pathCount;
+
+		// true,      
+		bool virtualDerivation;
+
+		// true,         
+		bool accessible;
+
+		//        , 
+		//        
+		string path;
+
+		//    
+		bool operator<( const BaseEntry &be ) const {
+			return classId < be.classId;
+		}
+	};
+
+private:
+	//  ,     
+	unsigned classId;
+
+	//  ,   
+	vector<BaseEntry> baseEntries;
+
+	//   
+	static unsigned classCounter;
+
+public:
+	//      ,   
+	//      
+	ClassHierarchyIndex( const BaseClassList &bcl );
+
+	//   
+	unsigned GetClassId() const {
+		return classId;
+	}
+
+	//    ,    
+	// ,  NULL
+	const BaseEntry *FindBase( const ClassType &base ) const;
+
+	//    ,   
+	const vector<BaseEntry> &GetBaseEntries() const {
+		return baseEntries;
+	}
+};
+
+
 //       
 typedef SmartPtr<ClassMember> PClassMember;
 
 
 //   .  ,     
-//     ,      
-// :  ListOfIdentifierList
+//     ,     
+//  -,     
 class ClassMemberList
 {
-	//      
-	mutable ListOfIdentifierList memberList;
+	//    ,    
+	HashTab memberIndex;
 
 	//      ,
 	//    
 	vector<PClassMember> order;
 
 public:
+	//   
+	ClassMemberList() 
+		: memberIndex(DEFAULT_CLASS_HASHTAB_SIZE) {
+	}
 
 	//  true,   
 	bool IsEmpty() const {
@@ -297,9 +367,10 @@ public:
 			PClassMember(NULL) : order[ix];
 	}
 
-	//      name    ,
-	//    ,   
-	IdentifierList *FindMember( const CharString &name ) const;
+	//      name,    ,  NULL
+	const IdentifierVector *FindMember( const CharString &name ) const {
+		return memberIndex.Find(name);
+	}
  
 	//    .     
 	//   ,  ,   ,  
@@ -308,6 +379,11 @@ public:
 
 	//      
 	void ClearMemberList();
+
+	//     
+	const HashTab &GetMemberIndex() const {
+		return memberIndex;
+	}
 };
 
 
@@ -463,9 +539,22 @@ class ClassType : public Identifier, public SymbolTable, public BaseType, public
 	//     
 	bool madeVmTable;
 
+	//       . 
+	//     ,   
+	// ,     
+	mutable map<string, IdentifierList> *baseLookupCache;
+
+	//  ,     
+	ClassHierarchyIndex *hierarchyIndex;
+
 	//  ,     
 	friend class ClassParserImpl;
 
+	//      ,  . 
+	//  ,     ,   
+	void FindInBaseClasses( const NRC::CharString &name, IdentifierList &out,
+		vector<const ClassType *> &virtualBases ) const;
+
 public:
 
 	//     , .. 
@@ -475,6 +564,8 @@ public:
 	//    
 	~ClassType() {
 		delete castOperatorList;
+		delete baseLookupCache;
+		delete hierarchyIndex;
 	}
 
 	//    (     )
@@ -596,6 +687,14 @@ public:
 	//   
 	void AddBaseClass( const PBaseClassCharacteristic &bcc );
 
+	//   ,     
+	void MakeHierarchyIndex();
+
+	//   ,     - NULL
+	const ClassHierarchyIndex *GetHierarchyIndex() const {
+		return hierarchyIndex;
+	}
+
 	//    ,     ,    ,
 	//   ,   ,  . 
 	// friend-         
@@ -79,91 +79,19 @@ bool ExpressionMakerUtils::IsConstant( const TypyziedEntity &op )
 
 
 //        .
-//       ,   
+//       ,   .
+//         
 bool ExpressionMakerUtils::CompareTypes( 
 		const TypyziedEntity &type1, const TypyziedEntity &type2 )
 {
-	// 1.   
-	const BaseType &bt1 = type1.GetBaseType(),
-				   &bt2 = type2.GetBaseType();
-
-	//   ,    
-	if( &bt1 != &bt2								   ||
-		bt1.GetSignModifier() != bt2.GetSignModifier() ||
-		bt1.GetSizeModifier() != bt2.GetSizeModifier() )
+	// 1.   .     
+	// ,    
+	if( &type1.GetBaseType() != &type2.GetBaseType() )
 		return false;
 
-	// 3.    
-	const DerivedTypeList &dtl1 = type1.GetDerivedTypeList(),
-						  &dtl2 = type2.GetDerivedTypeList();
-
-	// 3.    
-	if( dtl1.GetDerivedTypeCount() != dtl2.GetDerivedTypeCount() )
-		return false;
-
-	//          
-	for( int i = 0; i<dtl1.GetDerivedTypeCount(); i++ )
-	{
-		const DerivedType &dt1 = *dtl1.GetDerivedType(i),
-						  &dt2 = *dtl2.GetDerivedType(i);
-
-		//       
-		if( dt1.GetDerivedTypeCode() != dt2.GetDerivedTypeCode() )
-			return false;
-
-		//      
-		DerivedType::DT dc1 = dt1.GetDerivedTypeCode(), 
-						dc2 = dt2.GetDerivedTypeCode();
-
-		//    ,   
-		if( dc1 == DerivedType::DT_REFERENCE || dc2 == DerivedType::DT_POINTER )
-			;
-
-		//          
-		//  
-		else if( dc1 == DerivedType::DT_POINTER_TO_MEMBER )
-		{
-			const PointerToMember &ptm1 = static_cast<const PointerToMember &>(dt1),
-								  &ptm2 = static_cast<const PointerToMember &>(dt2);
-
-			// ,   
-			if( &ptm1.GetMemberClassType() != &ptm2.GetMemberClassType() )
-				return false;
-		}
-
-		//  ,    
-		else if( dc1 == DerivedType::DT_ARRAY )
-		{
-			if( dt1.GetDerivedTypeSize() != dt2.GetDerivedTypeSize() )
-				return false;
-		}
-
-		//   ,       ,
-		//    cv-  throw-
-		else if( dc1 == DerivedType::DT_FUNCTION_PROTOTYPE )
-		{
-			const FunctionPrototype &fp1 = static_cast<const FunctionPrototype &>(dt1),
-								    &fp2 = static_cast<const FunctionPrototype &>(dt2);	
-			
-			//    
-			const FunctionParametrList &fpl1 = fp1.GetParametrList(),
-									   &fpl2 = fp2.GetParametrList();
-
-			if( fpl1.GetFunctionParametrCount() != fpl2.GetFunctionParametrCount() )
-				return false;
-
-			//       
-			for( int i = 0; i<fpl1.GetFunctionParametrCount(); i++ )
-				if( !CompareTypes(*fpl1[i], *fpl2[i]) )
-					return false;					
-		}
-
-		//   
-		else
-			INTERNAL("'ExpressionMakerUtils::CompareTypes'    ");
-	}
-
-	return true;	
+	// 2.    
+	return type1.GetDerivedTypeList().GetCanonicalId() == 
+		   type2.GetDerivedTypeList().GetCanonicalId();
 }
 
 
@@ -388,6 +316,112 @@ PCaster &AutoCastManager::RevealCaster()
 }
 
 
+//   
+map<AutoCastManager::CacheKey, AutoCastManager::CacheValue> 
+	AutoCastManager::classificationCache;
+
+
+//  cv-   ,     
+bool AutoCastManager::MakeCvSignature( const TypyziedEntity &te, unsigned &cv )
+{
+	const DerivedTypeList &dtl = te.GetDerivedTypeList();
+	if( dtl.GetDerivedTypeCount() >= sizeof(unsigned) * 4 )
+		return false;
+
+	cv = te.IsConst() | (te.IsVolatile() << 1);
+	for( int i = 0; i<dtl.GetDerivedTypeCount(); i++ )
+	{
+		const DerivedType &dt = *dtl.GetDerivedType(i);
+		unsigned dcv = 0;
+
+		if( dt.GetDerivedTypeCode() == DerivedType::DT_POINTER )
+			dcv = static_cast<const Pointer &>(dt).IsConst() | 
+				(static_cast<const Pointer &>(dt).IsVolatile() << 1);
+
+		else if( dt.GetDerivedTypeCode() == DerivedType::DT_POINTER_TO_MEMBER )
+			dcv = static_cast<const PointerToMember &>(dt).IsConst() | 
+				(static_cast<const PointerToMember &>(dt).IsVolatile() << 1);
+
+		//      
+		// ,     
+		else if( dt.GetDerivedTypeCode() == DerivedType::DT_FUNCTION_PROTOTYPE )
+			return false;
+
+		cv |= dcv << (2 * (i+1));
+	}
+
+	return true;
+}
+
+
+//    
+bool AutoCastManager::MakeCacheKey( CacheKey &key ) const
+{
+	register bool cls1 = ExpressionMakerUtils::IsClassType(destType), 
+				  cls2 = ExpressionMakerUtils::IsClassType(srcType);
+
+	//      ,  
+	//     
+	if( !cls1 && !cls2 )
+		return false;
+
+	//        ,
+	//     
+	if( (cls1 && static_cast<const ClassType &>(destType.GetBaseType()).IsUncomplete()) ||
+		(cls2 && static_cast<const ClassType &>(srcType.GetBaseType()).IsUncomplete()) )
+		return false;
+
+	//     ,  - 
+	//     ,    
+	if( srcType.IsLiteral() || srcType.IsFunction() ||
+		!MakeCvSignature(destType, key.destCv) || !MakeCvSignature(srcType, key.srcCv) )
+		return false;
+
+	key.destId = CanonicalTypeTable::GetTypeId(destType);
+	key.srcId = CanonicalTypeTable::GetTypeId(srcType);
+	key.flags = isCopy | (explicitCast << 1);
+	return true;
+}
+
+
+//     , 
+//   
+PCaster AutoCastManager::RevealClassifiedCaster()
+{
+	CacheKey key;
+	bool cacheable = MakeCacheKey(key);
+	if( cacheable )
+	{
+		map<CacheKey, CacheValue>::iterator p = classificationCache.find(key);
+		if( CompilerStatistics::conversionCache.Count(p != classificationCache.end()) )
+			return new DeferredCaster(destType, srcType, isCopy, explicitCast,
+				(*p).second.first, (*p).second.second);
+	}
+
+	RevealCaster();
+	caster->ClassifyCast();
+
+	if( cacheable )
+		classificationCache.insert( map<CacheKey, CacheValue>::value_type(key, 
+			CacheValue(caster->IsConverted(), caster->GetCastCategory())) );
+	return caster;
+}
+
+
+//     
+Caster &DeferredCaster::GetCaster() const
+{
+	if( caster.IsNull() )
+	{
+		caster = AutoCastManager(destType, srcType, isCopy, explicitCast).RevealCaster();
+		caster->ClassifyCast();
+		INTERNAL_IF( caster->IsConverted() != isConverted );
+	}
+
+	return *caster;
+}
+
+
 //         
 const TypyziedEntity *ScalarToScalarCaster::GetBiggerType()
 {
@@ -1546,6 +1580,79 @@ void ClassToClassCaster::DoCast( const POperand &destOp, POperand &srcOp, const
 }
 
 
+//    
+void OverloadSetIndex::Build( const OverloadFunctionList &ofl )
+{
+	entries.clear();
+	arityBuckets.clear();
+	entries.resize(ofl.size());
+
+	for( int i = 0; i<ofl.size(); i++ )
+	{
+		Entry &e = entries[i];
+		const FunctionPrototype &fp = ofl[i]->GetFunctionPrototype();
+		const FunctionParametrList &pl = fp.GetParametrList();
+
+		e.fn = ofl[i];
+		e.ellipse = fp.IsHaveEllipse();
+		e.parametrCount = pl.GetFunctionParametrCount();
+
+		//       
+		for( e.minCount = 0; e.minCount < e.parametrCount; e.minCount++ )
+			if( pl.GetFunctionParametr(e.minCount)->IsHaveDefaultValue() )
+				break;
+
+		e.prefixHash.resize(e.parametrCount + 1);
+		e.prefixHash[0] = 0;
+		for( int j = 0; j<e.parametrCount; j++ )
+			e.prefixHash[j+1] = CombineHash(e.prefixHash[j], 
+				HashType(*pl.GetFunctionParametr(j)));
+	}
+
+	generation = Parametr::GetDefaultValueGeneration();
+}
+
+
+//   ,    'pcnt' .
+//    
+const vector<int> &OverloadSetIndex::GetArityBucket( int pcnt )
+{
+	map<int, vector<int> >::iterator p = arityBuckets.find(pcnt);
+	if( p != arityBuckets.end() )
+		return (*p).second;
+
+	vector<int> &bucket = arityBuckets[pcnt];
+	for( int i = 0; i<entries.size(); i++ )
+		if( entries[i].minCount <= pcnt && 
+			(pcnt <= entries[i].parametrCount || entries[i].ellipse) )
+			bucket.push_back(i);
+	return bucket;
+}
+
+
+//        
+unsigned OverloadSetIndex::HashType( const TypyziedEntity &te )
+{
+	const DerivedTypeList &dtl = te.GetDerivedTypeList();
+	unsigned h = (unsigned long)&te.GetBaseType();
+	int i = dtl.IsReference() ? 1 : 0;
+
+	//      
+	if( i < dtl.GetDerivedTypeCount() )
+	{
+		int code = dtl.GetDerivedType(i)->GetDerivedTypeCode();
+		if( code == DerivedType::DT_ARRAY )
+			h = CombineHash(h, DerivedType::DT_POINTER + 1), i++;
+		else if( code == DerivedType::DT_FUNCTION_PROTOTYPE )
+			h = CombineHash(h, DerivedType::DT_POINTER + 1);
+	}
+
+	for( ; i<dtl.GetDerivedTypeCount(); i++ )
+		h = CombineHash(h, dtl.GetDerivedType(i)->GetDerivedTypeCode() + 1);
+	return h;
+}
+
+
 //  true,   'fn'   'pcnt' 
 bool OverloadResolutor::CompareParametrCount( const Function &fn, int pcnt )
 {
@@ -1585,9 +1692,8 @@ bool OverloadResolutor::ViableFunction( const Function &fn )
 	ExpressionList::const_iterator p = apl.begin();
 	for( int i = 0; i<pcnt; i++, p++ )
 	{
-		PCaster caster = 
-			AutoCastManager( *pl.GetFunctionParametr(i), (*p)->GetType(), true).RevealCaster();
-		caster->ClassifyCast();
+		PCaster caster = AutoCastManager( 
+			*pl.GetFunctionParametr(i), (*p)->GetType(), true).RevealClassifiedCaster();
 
 		//   ,     
 		//     
@@ -1718,43 +1824,131 @@ void OverloadResolutor::DoParametrListCast( const Position &errPos )
 }
 
 
+//    
+map<OverloadFunctionList, OverloadSetIndex> OverloadResolutor::indexCache;
+
+
+//        
+bool OverloadResolutor::CheckCandidate( const Function &fn )
+{
+	//   , ,   
+	//   ,   		
+	if( object != NULL && fn.GetStorageSpecifier() != Function::SS_STATIC )
+	{
+		if( object->IsConst() > fn.GetFunctionPrototype().IsConst() ||
+			object->IsVolatile() > fn.GetFunctionPrototype().IsVolatile() )
+		{
+			if( errMsg.empty() )
+				errMsg = (string(" '") + fn.GetTypyziedEntityName().c_str() +
+					"'    ;  ").c_str();
+			return true;
+		}
+	}
+
+	//       
+	//  .    -  true.
+	if( !ViableFunction( fn ) )
+		return true;
+
+	//   , 'fn'  'candidate'.   
+	//  ,   ,   false.
+	//  candidate  , fn     
+	return SetBestViableFunction( fn );
+}
+
+
+//       .  
+//        ,  
+//        ,    
+//  -  ,    
+bool OverloadResolutor::ExactMatch( const OverloadSetIndex &ix, const vector<int> &bucket )
+{
+	//     .  
+	//     ,      
+	vector<unsigned> argHash(apl.size() + 1);
+	argHash[0] = 0;
+	for( int i = 0; i<apl.size(); i++ )
+	{
+		if( apl[i]->IsOverloadOperand() || apl[i]->GetType().GetDerivedTypeList().IsFunction() )
+			return false;
+		argHash[i+1] = OverloadSetIndex::CombineHash(argHash[i], 
+			OverloadSetIndex::HashType(apl[i]->GetType()));
+	}
+
+	//       , 
+	//   ,  ,    '...'
+	const OverloadSetIndex::Entry *exact = NULL;
+	for( vector<int>::const_iterator p = bucket.begin(); p != bucket.end(); p++ )
+	{
+		const OverloadSetIndex::Entry &e = ix.GetEntry(*p);
+		int cnt = e.parametrCount < apl.size() ? e.parametrCount : apl.size();
+		if( e.prefixHash[cnt] != argHash[cnt] )
+			continue;
+
+		if( exact != NULL || e.parametrCount != apl.size() || e.ellipse )
+			return false;
+		exact = &e;
+	}
+
+	if( exact == NULL )
+		return false;
+
+	//     
+	const Function &fn = *exact->fn;
+	if( object != NULL && fn.GetStorageSpecifier() != Function::SS_STATIC &&
+		(object->IsConst() > fn.GetFunctionPrototype().IsConst() ||
+		 object->IsVolatile() > fn.GetFunctionPrototype().IsVolatile()) )
+		return false;
+
+	if( !ViableFunction(fn) )
+	{
+		errMsg = "";
+		return false;
+	}
+
+	for( CasterList::iterator pc = viableCasterList.begin(); pc != viableCasterList.end(); pc++ )
+		if( (*pc)->GetCastCategory() != Caster::CC_EQUAL )
+			return false;
+
+	candidate = &fn;
+	candidateCasterList = viableCasterList;
+	return true;
+}
+
+
 //    ,     
 void OverloadResolutor::PermitUnambigousFunction()
 {
-	//     
-	for( OverloadFunctionList::const_iterator p = ofl.begin(); p != ofl.end(); p++ )
+	CompilerStatistics::overloadResolutions++;
+
+	//      ,  
+	//    ,     
+	if( ofl.size() > OVERLOAD_INDEX_LIMIT )
 	{
-		const Function &fn = *(*p);
+		OverloadSetIndex &ix = indexCache[ofl];
+		if( !ix.IsActual() )
+			ix.Build(ofl);
 
-		//  ,     
-		//   
-		if( !CompareParametrCount(fn, apl.size()) )
-			continue;
+		const vector<int> &bucket = ix.GetArityBucket(apl.size());
+		if( !CompilerStatistics::exactMatches.Count(ExactMatch(ix, bucket)) )
+			for( vector<int>::const_iterator p = bucket.begin(); p != bucket.end(); p++ )
+				if( !CheckCandidate( *ix.GetEntry(*p).fn ) )
+					break;
+	}
 
-		//    , ,   
-		//   ,   		
-		if( object != NULL && fn.GetStorageSpecifier() != Function::SS_STATIC )
+	//      
+	else
+	{
+		for( OverloadFunctionList::const_iterator p = ofl.begin(); p != ofl.end(); p++ )
 		{
-			if( object->IsConst() > fn.GetFunctionPrototype().IsConst() ||
-				object->IsVolatile() > fn.GetFunctionPrototype().IsVolatile() )
-			{
-				if( errMsg.empty() )
-					errMsg = (string(" '") + fn.GetTypyziedEntityName().c_str() +
-						"'    ;  ").c_str();
+			//  ,     
+			//   
+			if( !CompareParametrCount(**p, apl.size()) )
 				continue;
-			}
-		}
 
-		//       
-		//  .    -  true.
-		if( !ViableFunction( fn ) )
-			continue;
-
-		//   , 'fn'  'candidate'.   
-		//  ,   ,   false.
-		//  candidate  , fn     
-		if( !SetBestViableFunction( fn ) )
-			break;
+			if( !CheckCandidate(**p) )
+				break;
+		}
 	}
 
 	//        ,  
@@ -745,6 +745,39 @@ class AutoCastManager
 	//       
 	PCaster caster;
 
+	//   :   ,
+	// cv-       
+	struct CacheKey
+	{
+		unsigned destId, srcId, destCv, srcCv;
+		int flags;
+
+		//     
+		bool operator<( const CacheKey &k ) const {
+			if( destId != k.destId ) return destId < k.destId;
+			if( srcId != k.srcId ) return srcId < k.srcId;
+			if( destCv != k.destCv ) return destCv < k.destCv;
+			if( srcCv != k.srcCv ) return srcCv < k.srcCv;
+			return flags < k.flags;
+		}
+	};
+
+	//  :     
+	typedef pair<bool, Caster::CC> CacheValue;
+
+	//       
+	//  .     
+	static map<CacheKey, CacheValue> classificationCache;
+
+	//  cv-   .   
+	//  ,     ,  false
+	static bool MakeCvSignature( const TypyziedEntity &te, unsigned &cv );
+
+	//   .  false,   
+	//    ,      (, ),
+	//       
+	bool MakeCacheKey( CacheKey &key ) const;
+
 public:
 
 	//   ,  ,   
@@ -755,6 +788,143 @@ public:
 
 	//  
 	PCaster &RevealCaster();
+
+	//     . 
+	//       , 
+	//  ,     
+	//  
+	PCaster RevealClassifiedCaster();
+
+	//   ,    
+	// , ..        
+	static void ClearCache() {
+		classificationCache.clear();
+	}
+};
+
+
+//  .      
+//        , 
+//    .    
+//   ,      
+class DeferredCaster : public Caster
+{
+	// ,      
+	const TypyziedEntity &destType, &srcType;
+	bool isCopy, explicitCast;
+
+	//    
+	bool isConverted;
+	CC category;
+
+	//  ,   
+	mutable PCaster caster;
+
+	//     ,    
+	Caster &GetCaster() const;
+
+public:
+
+	//  ,    
+	DeferredCaster( const TypyziedEntity &dt, const TypyziedEntity &st, 
+		bool ic, bool ec, bool cnv, CC cc ) 
+		: destType(dt), srcType(st), isCopy(ic), explicitCast(ec), 
+		  isConverted(cnv), category(cc), caster(NULL) {
+	}
+
+	//   
+	void ClassifyCast() {
+	}
+
+	//    -  true
+	bool IsConverted() const {
+		return isConverted;
+	}
+
+	//     
+	void DoCast( const POperand &destOp, POperand &srcOp, const Position &errPos ) {
+		GetCaster().DoCast(destOp, srcOp, errPos);
+	}
+
+	//    
+	const CharString &GetErrorMessage( ) const {
+		return GetCaster().GetErrorMessage();
+	}
+
+	//   
+	CC GetCastCategory() const {
+		return category;
+	}
+};
+
+
+//    .     
+//         
+//       '...'.     
+//   ,      
+class OverloadSetIndex
+{
+public:
+	//   
+	struct Entry
+	{
+		// 
+		const Function *fn;
+
+		//      
+		//       
+		int parametrCount, minCount;
+
+		//    '...'
+		bool ellipse;
+
+		//   i , i  0  parametrCount
+		vector<unsigned> prefixHash;
+	};
+
+private:
+
+	//    
+	vector<Entry> entries;
+
+	//      , 
+	//    
+	map<int, vector<int> > arityBuckets;
+
+	//    ,    
+	unsigned generation;
+
+public:
+
+	//    
+	OverloadSetIndex() : generation(0) {
+	}
+
+	//    
+	void Build( const OverloadFunctionList &ofl );
+
+	//  ,      
+	bool IsActual() const {
+		return generation == Parametr::GetDefaultValueGeneration();
+	}
+
+	//   ,    'pcnt' 
+	const vector<int> &GetArityBucket( int pcnt );
+
+	//     
+	const Entry &GetEntry( int ix ) const {
+		return entries[ix];
+	}
+
+	//   .     , 
+	//     ,  ,   
+	//   ,   
+	static unsigned HashType( const TypyziedEntity &te );
+
+	//       
+	static unsigned CombineHash( unsigned h, unsigned th ) {
+		return h * 31 + th;
+	}
 };
 
 
@@ -794,9 +964,22 @@ class OverloadResolutor
 	// ,    .   NULL
 	const TypyziedEntity *object;
 
+	//    ,  
+	//  OVERLOAD_INDEX_LIMIT 
+	static map<OverloadFunctionList, OverloadSetIndex> indexCache;
+
 	//    ,     
 	void PermitUnambigousFunction();
 
+	//        .  false,
+	//       
+	bool CheckCandidate( const Function &fn );
+
+	//       . 
+	//     ,  
+	//      'bucket'       
+	bool ExactMatch( const OverloadSetIndex &ix, const vector<int> &bucket );
+
 	//  true,   'fn'   'pcnt' 
 	bool CompareParametrCount( const Function &fn, int pcnt );
 
@@ -841,6 +1024,12 @@ public:
 
 	//         
 	void DoParametrListCast( const Position &errPos );
+
+	//   ,     
+	// , ..    
+	static void ClearCache() {
+		indexCache.clear();
+	}
 };
 
 
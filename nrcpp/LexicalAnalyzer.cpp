@@ -91,10 +91,91 @@ struct keywords
 };
 
 
+//   ,   and, or, ...
+//  -   
+static keywords alt_words[] = {
+	{ "and",	LOGIC_AND  },
+	{ "and_eq", AND_ASSIGN },
+	{ "bitand", '&' },
+	{ "bitor",  '|' },
+	{ "compl",  '~' },
+	{ "not",	'!' },
+	{ "not_eq", NOT_EQUAL  },
+	{ "or",		LOGIC_OR   },
+	{ "or_eq",  OR_ASSIGN  },
+	{ "xor",	'^' },
+	{ "xor_eq", XOR_ASSIGN }
+};
+
+
 //    
 static string lexbuf;
 
 
+//   -   ( 
+//   ).     ,
+//  h = h * RESERVED_HASH_MUL + c,     
+// RESERVED_HASH_KEY.   ,   
+//      .    
+//     
+#define RESERVED_HASH_MUL		33
+#define RESERVED_HASH_KEY		129701
+#define RESERVED_HASH_BITS		8
+#define RESERVED_HASH_SIZE		(1 << RESERVED_HASH_BITS)
+
+//      - reinterpret_cast
+#define MAX_RESERVED_NAME_LEN	16
+
+
+//        -
+inline static unsigned ReservedNameSlot( unsigned h )
+{
+	return (unsigned)(h * RESERVED_HASH_KEY) >> (32 - RESERVED_HASH_BITS);
+}
+
+
+//   -   
+static unsigned ReservedNameHash( const char *name )
+{
+	register unsigned h = 0;
+	while( *name )
+		h = h * RESERVED_HASH_MUL + (unsigned char)*name++;
+	return h;
+}
+
+
+//   .   
+//   ,     
+//  
+static class ReservedNameTable
+{
+	//  ,     
+	keywords slots[RESERVED_HASH_SIZE];
+
+	//     
+	void Insert( const keywords *kmas, int szmas ) {
+		for( int i = 0; i < szmas / sizeof(keywords); i++ )
+			slots[ ReservedNameSlot(ReservedNameHash(kmas[i].name)) ] = kmas[i];
+	}
+
+public:
+	//     ++   
+	ReservedNameTable() {
+		memset(slots, 0, sizeof(slots));
+		Insert( cpp_words, sizeof(cpp_words) );
+		Insert( alt_words, sizeof(alt_words) );
+	}
+
+	//    ,  NAME,  
+	//  . h -  -  
+	int Find( const char *name, unsigned h ) const {
+		const keywords &kw = slots[ReservedNameSlot(h)];
+		return kw.name != NULL && !strcmp(kw.name, name) ? kw.code : NAME;
+	}
+
+} reservedNames;
+
+
 //       -1
 //       
 inline int LookupKeywordCode( const char *keyname, keywords *kmas, int szmas )
@@ -128,9 +209,12 @@ static int LookupCKeywords( const char *keyname )
 
 
 //     ++
-static int LookupCPPKeywords( const char *keyname )
+int LookupCPPKeywords( const char *keyname )
 {
-	return LookupKeywordCode( keyname, cpp_words, sizeof( cpp_words ) );
+	int code = reservedNames.Find( keyname, ReservedNameHash(keyname) );
+
+	//      
+	return code >= KWASM ? code : -1;
 }
 
 
@@ -141,6 +225,49 @@ const char *GetKeywordName( int code )
 }
 
 
+//    
+CppFileRead::CppFileRead( FILE *in ) 
+	: i(0)
+{
+	char block[4096];
+	size_t n;
+
+	while( (n = fread(block, 1, sizeof(block), in)) > 0 )
+		buf.append(block, n);
+	MemoryStatistics::Allocated( MemoryStatistics::MS_LEXER, buf.capacity() );
+}
+
+
+//    .    
+//   memchr,    
+//   ,     
+void CppFileRead::BuildLineTable() const
+{
+	const char *begin = buf.data(), *end = begin + buf.length();
+
+	lineStarts.push_back(0);
+	for( const char *p = begin; 
+		 (p = (const char *)memchr(p, '\n', end - p)) != NULL; p++ )
+		lineStarts.push_back( (p - begin) + 1 );
+	MemoryStatistics::Allocated( MemoryStatistics::MS_LEXER, lineStarts.capacity() * sizeof(unsigned) );
+}
+
+
+//        
+void CppFileRead::GetLineAndColumn( const Position &pos, unsigned &line, unsigned &col ) const
+{
+	if( lineStarts.empty() )
+		BuildLineTable();
+
+	//  ,    ,   
+	vector<unsigned>::const_iterator p = 
+		upper_bound(lineStarts.begin(), lineStarts.end(), pos.offset) - 1;
+
+	line = (p - lineStarts.begin()) + 1;
+	col  = pos.offset - *p + 1;
+}
+
+
 //     
 static int IgnoreNewlinesAndSpaces( BaseRead &ob )
 {
@@ -149,13 +276,7 @@ static int IgnoreNewlinesAndSpaces( BaseRead &ob )
 	while( (ob >> c) != EOF )
 
 		// :    1  (  4 )
-		if( c == ' ' || c == '\t' )		
-			continue;
-
-		else if( c == '\n' )		
-			((CppFileRead &)(ob)).NewLine();		
-
-		else
+		if( c != ' ' && c != '\t' && c != '\n' )		
 			break;
 
 	ob << c; //     
@@ -163,49 +284,24 @@ static int IgnoreNewlinesAndSpaces( BaseRead &ob )
 }
 
 
-// ,  'nam' -   
-//  and, or, ...     - 
-//  ,  0
-inline static int IsAlternativeName( const char *n ) 
-{
-	struct TempAgr
-	{
-		const char *name;
-		int tok;
-	} alt[] = {
-		"and",	  LOGIC_AND,
-		"and_eq", AND_ASSIGN, 
-		"bitand", '&',
-		"bitor",  '|',
-		"compl",  '~',
-		"not",	  '!',
-		"not_eq", NOT_EQUAL,
-		"or",	  LOGIC_OR,
-		"or_eq",  OR_ASSIGN,
-		"xor",	  '^',
-		"xor_eq", XOR_ASSIGN
-	};
-
-	for( int i = 0; i<11; i++ )
-		if( !strcmp( alt[i].name, n ) )
-			return alt[i].tok;
-	return 0;
-}
-
-
-//   ''
-inline static int LexemName( BaseRead &ob )
+//   ''.    
+//       .   
+//   -,    
+//   ,     
+inline static int LexemName( BaseRead &ob, int first )
 {
 	register int c;
+	register unsigned h = (unsigned char)first;
 
 	while( (ob >> c) != EOF )
 		if( !IS_NAME(c) )
 			break;
 		else
-			lexbuf += (char)c;
+			lexbuf += (char)c, h = h * RESERVED_HASH_MUL + (unsigned char)c;
 
 	ob << c;
-	return NAME;
+	return lexbuf.length() > MAX_RESERVED_NAME_LEN ? NAME
+		: reservedNames.Find(lexbuf.c_str(), h);
 }
 
 
@@ -798,15 +894,8 @@ static int Lex( BaseRead &ob, Position &lxmPos )
 				ob << p;
 		}
 
-		LexemName(ob);
-
-		//   ,   and, or...
-		if( int a = IsAlternativeName( lexbuf.c_str() ) )
-			return a;
-
-		//   ,
-		//    
-		return NAME;	
+		// ,  ,   ,   and, or...
+		return LexemName(ob, c);
 	}
 
 	else if( isdigit(c) || c == '.' )
@@ -876,14 +965,73 @@ const Lexem &LexicalAnalyzer::NextLexem()
 	//     	
 	lastLxm.code = Lex(*inStream, lastLxm.pos);
 	lastLxm.buf = lexbuf.c_str();
-	
-	//   ,     
-	if( lastLxm.code == NAME )
-	{
-		int nc = LookupCPPKeywords(lastLxm.buf.c_str());
-		if( nc != -1 )
-			lastLxm.code = nc;
-	}
 
+	//       
 	return lastLxm;
 }
+
+
+//  
+LexicalStatistics::LexicalStatistics()
+	: lexemCount(0), byteCount(0), seconds(0)
+{
+	for( int i = 0; i<LK_COUNT; i++ )
+		kindCount[i] = 0;
+}
+
+
+//     
+LexicalStatistics::LexemKind LexicalStatistics::GetLexemKind( int code )
+{
+	if( code == NAME )
+		return LK_NAME;
+
+	else if( code == KWTRUE || code == KWFALSE || code >= KWASM )
+		return LK_KEYWORD;
+
+	else if( code == CHARACTER || code == WCHARACTER )
+		return LK_CHARACTER;
+
+	else if( IS_INT_LITERAL(code) )
+		return LK_INTEGER;
+
+	else if( code == LFLOAT || code == LDOUBLE )
+		return LK_FLOAT;
+
+	else if( code == STRING || code == WSTRING )
+		return LK_STRING;
+
+	else
+		return LK_OPERATOR;
+}
+
+
+//      ,  
+void LexicalStatistics::Run( LexicalAnalyzer &la )
+{
+	clock_t start = clock();
+	for( int code; (code = la.NextLexem()) != EOF; )
+		kindCount[GetLexemKind(code)]++, lexemCount++;
+
+	seconds += (double)(clock() - start) / CLOCKS_PER_SEC;
+	byteCount += la.GetSourceSize();
+}
+
+
+//     
+void LexicalStatistics::Print( PCSTR title ) const
+{
+	static PCSTR kindNames[LK_COUNT] = {
+		"", " ", " ", " ",
+		" ", " ", ""
+	};
+
+	//       
+	double t = seconds > 0 ? seconds : 1.0 / CLOCKS_PER_SEC;
+
+	printf( "%s: %lu , %lu , %.3lf \n", title, byteCount, lexemCount, seconds );
+	printf( "\t%.0lf /, %.0lf /\n", lexemCount / t, byteCount / t );
+	for( int i = 0; i<LK_COUNT; i++ )
+		printf( "\t%-22s %10lu (%5.1lf%%)\n", kindNames[i], kindCount[i], 
+			lexemCount ? 100.0 * kindCount[i] / lexemCount : 0.0 );
+}
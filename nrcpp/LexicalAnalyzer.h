@@ -133,37 +133,54 @@ public:
 };
 
 
-//      ++ 
+//      ++ .  
+//   ,      .
+//       ,    
 class CppFileRead : public BaseRead 
 {
-	//    
-	FILE *in;
+	//  
+	string buf;
+
+	//    
+	unsigned i;
 
+	//    .    
+	//    , ..   
+	mutable vector<unsigned> lineStarts;
 
-	//      - 
-	Position &pos;
+	//    
+	void BuildLineTable() const;
 
 public:
-	CppFileRead( FILE *i, Position &p ) : in(i), pos(p) { }
-	~CppFileRead( ) {   }
+	//    
+	CppFileRead( FILE *in );
+
+	//       
+	~CppFileRead( ) { 
+		MemoryStatistics::Freed( MemoryStatistics::MS_LEXER, 
+			buf.capacity() + lineStarts.capacity() * sizeof(unsigned) );
+	}
 
 	//     
 	int operator>>( register int &c ) {
-		c = fgetc(in);
-		pos.col++;
+		if( i == buf.length() ) 
+			return (c = EOF);
+
+		c = (unsigned char)buf[i++];
 		return c;
 	}
 
 	//    
-	void operator<<( register int &c ) { pos.col--; ungetc(c, in); }
-
-
-	//        
-	void NewLine() { pos.line++, pos.col = 1; }
+	void operator<<( register int &c ) { if(c != EOF) i--; }
 
 	//  
-	Position GetPosition() const { return pos; }
+	Position GetPosition() const { return Position(i); }
 
+	//     
+	unsigned GetSize() const { return buf.length(); }
+
+	//        
+	void GetLineAndColumn( const Position &pos, unsigned &line, unsigned &col ) const;
 };
 
 
@@ -182,14 +199,27 @@ class Lexem
 
 public:
 
-	//   
+	//   .     
+	//    ,   
 	Lexem() {
 		code = 0;
+		MemoryStatistics::Allocated( MemoryStatistics::MS_LEXER, sizeof(Lexem) );
 	}
 
 
 	//    
 	Lexem( const CharString &b, int c, const Position &p ) : buf(b), code(c), pos(p) {
+		MemoryStatistics::Allocated( MemoryStatistics::MS_LEXER, sizeof(Lexem) );
+	}
+
+	//  
+	Lexem( const Lexem &lxm ) : buf(lxm.buf), code(lxm.code), pos(lxm.pos) {
+		MemoryStatistics::Allocated( MemoryStatistics::MS_LEXER, sizeof(Lexem) );
+	}
+
+	// 
+	~Lexem() {
+		MemoryStatistics::Freed( MemoryStatistics::MS_LEXER, sizeof(Lexem) );
 	}
 
 	//  
@@ -240,9 +270,6 @@ class LexicalAnalyzer
 	//     
 	CppFileRead *inStream;
 
-	//   
-	const Position &curPos;
-
 	//   ,    NULL,  
 	//   ,   .    
 	// 
@@ -253,8 +280,8 @@ public:
 	//       
 	//         
 	// 
-	LexicalAnalyzer( FILE *in, Position &pos ) : curPos(pos), lexemContainer(NULL) {
-		inStream = new CppFileRead(in, pos);
+	LexicalAnalyzer( FILE *in ) : lexemContainer(NULL) {
+		inStream = new CppFileRead(in);
 	}
 
 
@@ -299,6 +326,61 @@ public:
 	void SetLastLexem( const Lexem &lxm ) {
 		lastLxm = lxm;
 	}
+
+	//      
+	Position GetCurrentPosition() const {
+		return inStream->GetPosition();
+	}
+
+	//        
+	void GetLineAndColumn( const Position &pos, unsigned &line, unsigned &col ) const {
+		inStream->GetLineAndColumn(pos, line, col);
+	}
+
+	//      
+	unsigned GetSourceSize() const {
+		return inStream->GetSize();
+	}
+};
+
+
+//   .    
+//  ,      
+//   
+class LexicalStatistics
+{
+public:
+	//  ,    
+	enum LexemKind {
+		LK_NAME, LK_KEYWORD, LK_INTEGER, LK_FLOAT, 
+		LK_STRING, LK_CHARACTER, LK_OPERATOR, LK_COUNT
+	};
+
+private:
+	//    
+	unsigned long kindCount[LK_COUNT];
+
+	//   
+	unsigned long lexemCount;
+
+	//   
+	unsigned long byteCount;
+
+	//    
+	double seconds;
+
+	//     
+	static LexemKind GetLexemKind( int code );
+
+public:
+	//  
+	LexicalStatistics();
+
+	//      ,  
+	void Run( LexicalAnalyzer &la );
+
+	//     
+	void Print( PCSTR title ) const;
 };
 
 
@@ -82,18 +82,33 @@
 // ----------------------------------------------------------------
 
 
-//  -   
-#define	DEFAULT_NAMESPACE_HASHTAB_SIZE	111
+//   -   ,
+//     
+#define	DEFAULT_NAMESPACE_HASHTAB_SIZE	128
 
 
-//  -   
-#define DEFAULT_GLOBAL_HASHTAB_SIZE		513
+//   -   
+#define DEFAULT_GLOBAL_HASHTAB_SIZE		512
+
+
+//   -  
+#define DEFAULT_CLASS_HASHTAB_SIZE		8
 
 
 //  -   
 #define DEFAULT_LOCAL_HASHTAB_SIZE		11
 
 
+//       ,  
+//   ,  -
+#define LOCAL_SCOPE_LINEAR_LIMIT		8
+
+
+//     ,   
+//   ,   
+#define OVERLOAD_INDEX_LIMIT			4
+
+
 // ----------------------------------------------------------------
 //       
 // ----------------------------------------------------------------
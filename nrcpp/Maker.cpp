@@ -1453,8 +1453,17 @@ void FunctionPrototypeMaker::MakeParametr( const NodePackage &pp, int pnum )
 
 		//    ,     error operand,
 		//    ,    
-		param->SetDefaultValue( rda->IsErrorOperand() ? &const_cast<Operand&>(*rda) : 
-			const_cast<POperand&>(rda).Release() );
+		if( rda->IsErrorOperand() )
+			param->SetDefaultValue( &const_cast<Operand&>(*rda) );
+
+		//      , 
+		//      
+		else
+		{
+			const_cast<POperand&>( static_cast<const ExpressionPackage*>(
+				pp.GetChildPackage(2))->GetExpression() ) = NULL;
+			param->SetDefaultValue( const_cast<POperand&>(rda).Release() );
+		}
 	}
 
 	parametrList.AddFunctionParametr( param );
@@ -1659,9 +1668,13 @@ skip_make_parametrs:
 		toc.constQual, toc.volatileQual, toc.dtl, toc.ssCode < 0 ? ::Object::SS_NONE : 
 		TypeSpecifierManager(toc.ssCode).CodeToStorageSpecifierObj(), toc.clinkSpec );
 
-	//          
+	//          . 
+	//       catch-,   
+	//      
 	if( ix >= 0 )
 		GetCurrentSymbolTable().InsertSymbol(targetObject);
+	else if( GetCurrentSymbolTable().IsLocalSymbolTable() )
+		static_cast<LocalSymbolTable &>(GetCurrentSymbolTable()).Retain();
 	return targetObject; 
 }
 
@@ -35,20 +35,68 @@ const UsingIdentifier *SynonymList::find_using_identifier( const Identifier *id
 }
 
 
+//   
+map<NameManager::NameQuery, NameManager::PNameRoles> NameManager::roleCache;
+
+
 //   ,    
 //  . 
 // qn -  (), bt -  ,     
 //  , watchFriend -       ,
 //   -  ,   - using 
 NameManager::NameManager( const CharString &qn, const SymbolTable *bt, bool watchFriend )
-		: queryName(qn), bindTable(bt)
+		: queryName(qn), bindTable(bt), roles(NULL)
 {
+	NameQuery query(qn, bt, watchFriend);
+	map<NameQuery, PNameRoles>::iterator p = roleCache.find(query);
+	if( p != roleCache.end() && IsActual((*p).second->stamp) )
+	{
+		roles = (*p).second;
+		return;
+	}
+
+	//      ,
+	//       
+	roles = new NameRoles;
+	Lookup(watchFriend);
+
+	if( p == roleCache.end() )
+		roleCache.insert( map<NameQuery, PNameRoles>::value_type(query, roles) );
+	else
+		(*p).second = roles;
+}
+
+
+// true,      ls  .
+//        ,
+//    ,   
+bool NameManager::IsActual( const LookupStamp &ls ) const
+{
+	if( bindTable == NULL )
+		return theApp.GetTranslationUnit().GetScopeSystem().IsActual(ls);
+
+	return ls.generation == SymbolTable::GetGeneration() &&
+		bindTable->GetStamp() == ls.chain.front().second;
+}
+
+
+//       .  
+//   ,      
+//   
+void NameManager::Lookup( bool watchFriend )
+{
+	LookupStamp &ls = roles->stamp;
+
 	//  
 	IdentifierList foundList;
 
 	//         
 	if( bindTable != NULL )
 	{
+		ls.generation = SymbolTable::GetGeneration();
+		ls.chain.push_back( 
+			pair<const SymbolTable *, unsigned>(bindTable, bindTable->GetStamp()) );
+
 		//       
 		if( watchFriend )
 			bindTable->FindSymbol( queryName, foundList );
@@ -63,7 +111,7 @@ NameManager::NameManager( const CharString &qn, const SymbolTable *bt, bool watc
 	//    -      
 	//     ,   
 	else
-		theApp.GetTranslationUnit().GetScopeSystem().DeepSearch(queryName, foundList);
+		theApp.GetTranslationUnit().GetScopeSystem().DeepSearch(queryName, foundList, &ls);
 
 	//    .
 	if( foundList.empty() )
@@ -83,7 +131,7 @@ NameManager::NameManager( const CharString &qn, const SymbolTable *bt, bool watc
 		if( role == R_USING_IDENTIFIER )
 		{
 			//         
-			synonymList.push_back( RolePair(id, role) );
+			roles->synonymList.push_back( RolePair(id, role) );
 			id = const_cast<Identifier *>(
 					&static_cast<UsingIdentifier *>(id)->GetUsingIdentifier());
 			role = GetIdentifierRole(id);
@@ -93,13 +141,13 @@ NameManager::NameManager( const CharString &qn, const SymbolTable *bt, bool watc
 		//     ,     
 		else if( role == R_NAMESPACE_ALIAS )
 		{
-			synonymList.push_back( RolePair(id, role) );
+			roles->synonymList.push_back( RolePair(id, role) );
 			id = const_cast<NameSpace *>(&static_cast<NameSpaceAlias *>(id)->GetNameSpace()); 
 			role = R_NAMESPACE;
 		}
 
 		//      
-		this->roleList.push_back( RolePair(id, role) );
+		roles->roleList.push_back( RolePair(id, role) );
 	}
 }
 
@@ -944,6 +992,27 @@ CharString ManagerUtils::GetSymbolTableName( const SymbolTable &st )
 }
 
 
+//         
+//   'Base'    'Derived'.  
+//       
+DerivationManager::DerivationManager( const ClassType &base, const ClassType &derived )
+	: accessible(false), virtualDerivation(false), baseCount(0) 
+{
+	if( const ClassHierarchyIndex *hix = derived.GetHierarchyIndex() )
+	{
+		if( const ClassHierarchyIndex::BaseEntry *be = hix->FindBase(base) )
+		{
+			baseCount = be->pathCount;
+			virtualDerivation = be->virtualDerivation;
+			accessible = be->accessible;
+		}
+	}
+
+	else
+		Characterize( base, derived, true );
+}
+
+
 //    'base'    'derived'
 void DerivationManager::Characterize( const ClassType &base, 
 							const ClassType &curCls, bool ac )
@@ -108,16 +108,6 @@ class NameManager
 	//  
 	CharString queryName;
 
-	//    
-	RoleList roleList;
-	
-	//   -.  
-	//      using-.
-	//     , .. , 
-	//       .   
-	//   
-	SynonymList synonymList;
-
 	//           
 	//        
 	// (  - ,   - using-).  
@@ -129,6 +119,69 @@ class NameManager
 	//   -  ,   - using 
 	bool watchFriend;
 
+	//   ,    
+	struct NameQuery
+	{
+		// 
+		string name;
+
+		//   
+		const SymbolTable *bindTable;
+
+		//    
+		bool watchFriend;
+
+		//  
+		NameQuery( const string &n, const SymbolTable *bt, bool wf )
+			: name(n), bindTable(bt), watchFriend(wf) {
+		}
+
+		//     map
+		bool operator<( const NameQuery &q ) const {
+			if( bindTable != q.bindTable )
+				return bindTable < q.bindTable;
+			if( watchFriend != q.watchFriend )
+				return watchFriend < q.watchFriend;
+			return name < q.name;
+		}
+	};
+
+	//   .    ,
+	//        . 
+	//   ,   
+	struct NameRoles : public NRC::RefCounted
+	{
+		//    
+		RoleList roleList;
+
+		//   -.  
+		//      using-.
+		//     , .. , 
+		//       .   
+		//   
+		SynonymList synonymList;
+
+		//  ,     
+		LookupStamp stamp;
+	};
+
+	//    
+	typedef SmartPtr<NameRoles> PNameRoles;
+
+	//    
+	PNameRoles roles;
+
+	//   .     ,
+	//    ,     
+	//      
+	static map<NameQuery, PNameRoles> roleCache;
+
+	// true,      ls  
+	bool IsActual( const LookupStamp &ls ) const;
+
+	//   ,      
+	void Lookup( bool watchFriend );
+
 public:
 
 	//   ,    
@@ -153,21 +206,27 @@ public:
 	//    (.  ,  -,
 	// ).  false,   
 	const RoleList &GetRoleList( ) const {
-		return roleList;
+		return roles->roleList;
 	}		
 
 	//     
 	int GetRoleCount() const {
-		return roleList.size();
+		return roles->roleList.size();
 	}
 
 	//   
 	const SynonymList &GetSynonymList() const {
-		return synonymList; 
+		return roles->synonymList; 
 	}
 
 	//   
 	static Role GetIdentifierRole( const Identifier *id ) ;
+
+	//    ,    
+	//  , ..     
+	static void ClearCache() {
+		roleCache.clear();
+	}
 };
 
 
@@ -416,11 +475,7 @@ public:
 
 	//         
 	//   'Base'    'Derived'
-	DerivationManager( const ClassType &base, const ClassType &derived )
-		: accessible(false), virtualDerivation(false), baseCount(0) {
-
-		Characterize( base, derived, true );
-	}
+	DerivationManager( const ClassType &base, const ClassType &derived );
 
 	// ,        'base'
 	bool IsBase() const {
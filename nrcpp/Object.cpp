@@ -29,6 +29,61 @@ namespace TranslatorUtils
 }
 
 
+//     
+NRC::Arena *Identifier::arena = NULL;
+
+// ,   
+vector<Identifier::ArenaEntry> Identifier::arenaIdentifiers;
+
+//    
+const char *Identifier::pendingBegin = NULL, *Identifier::pendingEnd = NULL;
+
+
+//  ,     . 
+//      ,   
+//   ,    
+void Identifier::RegisterInArena()
+{
+	arenaIndex = -1;
+	if( (const char *)this < pendingBegin || (const char *)this >= pendingEnd )
+		return;
+
+	ArenaEntry ae;
+	ae.id = this;
+	ae.size = pendingEnd - pendingBegin;
+	arenaIndex = arenaIdentifiers.size();
+	arenaIdentifiers.push_back(ae);
+	pendingBegin = pendingEnd = NULL;
+}
+
+
+//  ,   . 
+//   ,  , ..   
+//    ,  ,  
+//      .    
+//      ,  ,
+//   ,   
+void Identifier::DestroyArenaIdentifiers()
+{
+	INTERNAL_IF( arena == NULL );
+	NRC::Arena::SetDestroying(arena);
+	while( !arenaIdentifiers.empty() )
+	{
+		ArenaEntry ae = arenaIdentifiers.back();
+		arenaIdentifiers.pop_back();
+		if( ae.id == NULL )
+			continue;
+
+		ae.id->arenaIndex = -1;
+		ae.id->~Identifier();
+		MemoryStatistics::Freed( MemoryStatistics::MS_IDENTIFIERS, ae.size );
+	}
+
+	NRC::Arena::SetDestroying(NULL);
+	pendingBegin = pendingEnd = NULL;
+}
+
+
 //    
 NRC::CharString Identifier::GetQualifiedName() const
 {
@@ -476,49 +531,143 @@ ClassCastOverloadOperator::ClassCastOverloadOperator(
 }
 
 
+//  
+DerivedTypeList::DerivedTypeList( const DerivedTypeList &dtl )
+	: items(GetInlineItems()), capacity(INLINE_CAPACITY), first(INLINE_CAPACITY/4), count(0)
+{
+	AddDerivedTypeList(dtl);
+	canonicalId = dtl.canonicalId;
+	canonicalGeneration = dtl.canonicalGeneration;
+}
+
+
+//     
+DerivedTypeList::~DerivedTypeList()
+{
+	ClearDerivedTypeList();
+	if( items != GetInlineItems() )
+	{
+		MemoryStatistics::Freed( MemoryStatistics::MS_TYPES, capacity * sizeof(PDerivedType) );
+		::operator delete(items);
+	}
+}
+
+
+//  
+DerivedTypeList &DerivedTypeList::operator=( const DerivedTypeList &dtl )
+{
+	if( &dtl == this )
+		return *this;
+
+	ClearDerivedTypeList();
+	AddDerivedTypeList(dtl);
+	canonicalId = dtl.canonicalId;
+	canonicalGeneration = dtl.canonicalGeneration;
+	return *this;
+}
+
+
+//     .     
+//  ,   .   
+//     ,  
+//   
+void DerivedTypeList::Relayout()
+{
+	int newCapacity = capacity - count >= 2 ? capacity : 
+		(capacity * 2 > count + 2 ? capacity * 2 : count + 2);
+	int newFirst = (newCapacity - count) / 2, i;
+
+	//  ,    ,   
+	//     
+	if( newCapacity == capacity )
+	{
+		if( newFirst > first )
+			for( i = count-1; i >= 0; i-- )
+			{
+				new (items + newFirst + i) PDerivedType(items[first + i]);
+				items[first + i].~PDerivedType();
+			}
+
+		else if( newFirst < first )
+			for( i = 0; i < count; i++ )
+			{
+				new (items + newFirst + i) PDerivedType(items[first + i]);
+				items[first + i].~PDerivedType();
+			}
+
+		first = newFirst;
+		return;
+	}
+
+	//        
+	PDerivedType *newItems = (PDerivedType *)::operator new(newCapacity * sizeof(PDerivedType));
+	MemoryStatistics::Allocated( MemoryStatistics::MS_TYPES, newCapacity * sizeof(PDerivedType) );
+	for( i = 0; i < count; i++ )
+	{
+		new (newItems + newFirst + i) PDerivedType(items[first + i]);
+		items[first + i].~PDerivedType();
+	}
+
+	if( items != GetInlineItems() )
+	{
+		MemoryStatistics::Freed( MemoryStatistics::MS_TYPES, capacity * sizeof(PDerivedType) );
+		::operator delete(items);
+	}
+	items = newItems;
+	capacity = newCapacity;
+	first = newFirst;
+}
+
+
 //      cv- 
 //  ,    '*', 'ptr-to-member', '()', 
 //       
 bool DerivedTypeList::AddDerivedTypeListCV( const DerivedTypeList &dtl, bool c, bool v )
 {
+	canonicalGeneration = 0;
 	bool was_qual = false;
-	vector<PDerivedType>::const_iterator p = dtl.derivedTypeList.begin();
+	int ix = 0;
+
+	//   , ..      
+	int n = dtl.count;
 
-	for( ;p != dtl.derivedTypeList.end(); p++ )
+	for( ; ix < n; ix++ )
 	{
+		PDerivedType p = dtl.items[dtl.first + ix];
+
 		//   ,  
-		if( (*p)->GetDerivedTypeCode() == DerivedType::DT_ARRAY )			
+		if( p->GetDerivedTypeCode() == DerivedType::DT_ARRAY )			
 		{
-			AddDerivedType( *p );
+			AddDerivedType( p );
 			continue;
 		}
 
 		//  ,   , ..   
 		//  
-		else if( (*p)->GetDerivedTypeCode() == DerivedType::DT_REFERENCE )		
-			AddDerivedType( *p );					
+		else if( p->GetDerivedTypeCode() == DerivedType::DT_REFERENCE )		
+			AddDerivedType( p );					
 
 		//     
-		else if( (*p)->GetDerivedTypeCode() == DerivedType::DT_POINTER )
+		else if( p->GetDerivedTypeCode() == DerivedType::DT_POINTER )
 		{
-			bool pc = c || ((Pointer &)(**p)).IsConst(),
-				 pv = v || ((Pointer &)(**p)).IsVolatile();
+			bool pc = c || ((Pointer &)(*p)).IsConst(),
+				 pv = v || ((Pointer &)(*p)).IsVolatile();
 			AddDerivedType( PDerivedType(new Pointer(pc, pv)) );
 		}
 
 		//       
-		else if( (*p)->GetDerivedTypeCode() == DerivedType::DT_POINTER_TO_MEMBER )
+		else if( p->GetDerivedTypeCode() == DerivedType::DT_POINTER_TO_MEMBER )
 		{
-			bool pc = c || ((PointerToMember &)(**p)).IsConst(),
-				 pv = v || ((PointerToMember &)(**p)).IsVolatile();
-			const ClassType &cls = ((PointerToMember &)(**p)).GetMemberClassType();
+			bool pc = c || ((PointerToMember &)(*p)).IsConst(),
+				 pv = v || ((PointerToMember &)(*p)).IsVolatile();
+			const ClassType &cls = ((PointerToMember &)(*p)).GetMemberClassType();
 			AddDerivedType( PDerivedType(new PointerToMember(&cls, pc, pv)) );
 		}
 
 		//     
-		else if( (*p)->GetDerivedTypeCode() == DerivedType::DT_FUNCTION_PROTOTYPE )
+		else if( p->GetDerivedTypeCode() == DerivedType::DT_FUNCTION_PROTOTYPE )
 		{
-			FunctionPrototype &fp = ((FunctionPrototype &)**p);
+			FunctionPrototype &fp = ((FunctionPrototype &)*p);
 			bool pc = c || fp.IsConst(),
 				 pv = v || fp.IsVolatile();
 			AddDerivedType( PDerivedType(new FunctionPrototype(
@@ -535,6 +684,118 @@ bool DerivedTypeList::AddDerivedTypeListCV( const DerivedTypeList &dtl, bool c,
 	}
 
 	if( was_qual )
-		derivedTypeList.insert( derivedTypeList.end(), p+1, dtl.derivedTypeList.end());
+		for( ix++; ix < n; ix++ )
+			AddDerivedType( dtl.items[dtl.first + ix] );
 	return was_qual;
 }
+
+
+//    .  
+//    ,      
+unsigned DerivedTypeList::GetCanonicalId() const
+{
+	if( canonicalGeneration != CanonicalTypeTable::GetGeneration() )
+	{
+		canonicalId = CanonicalTypeTable::GetDerivedTypeListId(*this);
+		canonicalGeneration = CanonicalTypeTable::GetGeneration();
+	}
+
+	return canonicalId;
+}
+
+
+//    
+void Array::SetArraySize( int sz )
+{
+	size = sz;
+	CanonicalTypeTable::IncreaseGeneration();
+}
+
+
+//    ,    
+//    
+unsigned Parametr::defaultValueGeneration = 1;
+
+
+//   
+map<CanonicalTypeTable::NodeKey, unsigned> CanonicalTypeTable::nodes;
+
+//   
+map<vector<unsigned>, unsigned> CanonicalTypeTable::parametrLists;
+
+// 
+map<pair<const BaseType *, unsigned>, unsigned> CanonicalTypeTable::types;
+
+//  ,     
+unsigned CanonicalTypeTable::generation = 1;
+
+
+//     .  
+//  ,       
+unsigned CanonicalTypeTable::GetDerivedTypeListId( const DerivedTypeList &dtl )
+{
+	unsigned id = 0;
+	for( int i = dtl.GetDerivedTypeCount()-1; i >= 0; i-- )
+	{
+		const DerivedType &dt = *dtl.GetDerivedType(i);
+		NodeKey key;
+		key.code = dt.GetDerivedTypeCode();
+		key.memberClass = NULL;
+		key.value = 0;
+		key.tail = id;
+
+		//         
+		if( key.code == DerivedType::DT_REFERENCE || key.code == DerivedType::DT_POINTER )
+			;
+
+		//      
+		else if( key.code == DerivedType::DT_POINTER_TO_MEMBER )
+			key.memberClass = &static_cast<const PointerToMember &>(dt).GetMemberClassType();
+
+		//   
+		else if( key.code == DerivedType::DT_ARRAY )
+			key.value = dt.GetDerivedTypeSize();
+
+		//   -  
+		else if( key.code == DerivedType::DT_FUNCTION_PROTOTYPE )
+		{
+			const FunctionParametrList &fpl = 
+				static_cast<const FunctionPrototype &>(dt).GetParametrList();
+
+			vector<unsigned> prmIds;
+			prmIds.reserve(fpl.GetFunctionParametrCount());
+			for( int j = 0; j<fpl.GetFunctionParametrCount(); j++ )
+				prmIds.push_back( GetTypeId(*fpl.GetFunctionParametr(j)) );
+
+			map<vector<unsigned>, unsigned>::iterator pl = parametrLists.find(prmIds);
+			if( pl == parametrLists.end() )
+				pl = parametrLists.insert( 
+					map<vector<unsigned>, unsigned>::value_type(prmIds, parametrLists.size()+1) ).first;
+			key.value = (*pl).second;
+		}
+
+		else
+			INTERNAL("'CanonicalTypeTable::GetDerivedTypeListId'    ");
+
+		map<NodeKey, unsigned>::iterator p = nodes.find(key);
+		if( p == nodes.end() )
+			p = nodes.insert( map<NodeKey, unsigned>::value_type(key, nodes.size()+1) ).first;
+		id = (*p).second;
+	}
+
+	return id;
+}
+
+
+//     
+unsigned CanonicalTypeTable::GetTypeId( const TypyziedEntity &te )
+{
+	pair<const BaseType *, unsigned> key( &te.GetBaseType(), 
+		te.GetDerivedTypeList().GetCanonicalId() );
+
+	map<pair<const BaseType *, unsigned>, unsigned>::iterator p = types.find(key);
+	if( p == types.end() )
+		p = types.insert( 
+			map<pair<const BaseType *, unsigned>, unsigned>::value_type(key, types.size()+1) ).first;
+	return (*p).second;
+}
@@ -36,23 +36,105 @@ protected:
 	//    
 	string c_name;
 
+	//     ,   
+	// .   ,   
+	static NRC::Arena *arena;
+
+	// ,   ,    
+	struct ArenaEntry
+	{
+		// , NULL    
+		Identifier *id;
+
+		//    
+		size_t size;
+	};
+
+	// ,   ,   . 
+	//     ,   
+	//    
+	static vector<ArenaEntry> arenaIdentifiers;
+
+	//    .  , 
+	//   ,    
+	static const char *pendingBegin, *pendingEnd;
+
+	//    arenaIdentifiers, -1   
+	//    
+	int arenaIndex;
+
+	//        ,
+	//         
+	enum { HEADER_SIZE = NRC::Arena::ALIGNMENT };
+
+	//  ,     
+	void RegisterInArena();
+
 public:
 
+	//      . 
+	//        
+	static void SetArena( NRC::Arena *a ) {
+		arena = a;
+	}
+
+	//  ,   . 
+	//   ,   
+	static void DestroyArenaIdentifiers();
+
+	//        
+	static void *operator new( size_t sz ) {
+		MemoryStatistics::Allocated( MemoryStatistics::MS_IDENTIFIERS, sz );
+		char *p = (char *)(arena != NULL ? 
+			arena->Allocate(sz + HEADER_SIZE) : ::operator new(sz + HEADER_SIZE));
+		*p = arena != NULL;
+		p += HEADER_SIZE;
+		if( arena != NULL )
+			pendingBegin = p, pendingEnd = p + sz;
+		return p;
+	}
+
+	//        ,
+	//     .    
+	//     
+	static void operator delete( void *p, size_t sz ) {
+		MemoryStatistics::Freed( MemoryStatistics::MS_IDENTIFIERS, sz );
+		if( p != NULL && !*((char *)p - HEADER_SIZE) )
+			::operator delete((char *)p - HEADER_SIZE);
+	}
+
 	//   
 	Identifier() { 
 		pTable = NULL;
+		RegisterInArena();
 	}
 
 	
 	//    
 	Identifier( const NRC::CharString &n, const SymbolTable *p )
 		: name(n), pTable(p) {		
-		
+		RegisterInArena();
+	}
+
+	//  ,     
+	Identifier( const Identifier &id )
+		: name(id.name), pTable(id.pTable), c_name(id.c_name) {
+		RegisterInArena();
+	}
+
+	//     
+	Identifier &operator=( const Identifier &id ) {
+		name = id.name;
+		pTable = id.pTable;
+		c_name = id.c_name;
+		return *this;
 	}
 
 	//     . 
 	//     
 	virtual ~Identifier() {
+		if( arenaIndex >= 0 )
+			arenaIdentifiers[arenaIndex].id = NULL;
 	}
 
 	//    
@@ -88,7 +170,7 @@ typedef list<IdentifierList> ListOfIdentifierList;
 
 
 //    
-class ClassMember
+class ClassMember : public NRC::RefCounted
 {
 public:	
 	//  ,  ..   
@@ -207,7 +289,7 @@ public:
 
 
 //    5   
-class DerivedType
+class DerivedType : public NRC::RefCounted
 {
 public:
 
@@ -232,6 +314,21 @@ public:
 	//  
 	virtual ~DerivedType() { }
 
+	//          .
+	//         
+	//    ,    , 
+	//      
+	static void *operator new( size_t sz ) {
+		MemoryStatistics::Allocated( MemoryStatistics::MS_TYPES, sz );
+		return ::operator new(sz);
+	}
+
+	//    
+	static void operator delete( void *p, size_t sz ) {
+		MemoryStatistics::Freed( MemoryStatistics::MS_TYPES, sz );
+		::operator delete(p);
+	}
+
 	//    
 	DT GetDerivedTypeCode() const {		
 		return derivedTypeCode;
@@ -246,67 +343,123 @@ public:
 typedef SmartPtr<DerivedType> PDerivedType;
 
 
-//   
+//   .     
+// ,  -    .    
+// ,      ,     ,
+//    
 class DerivedTypeList
 {
-	//       DerivedType
-	vector<PDerivedType> derivedTypeList;
+	//   .     
+	//   ,   -     
+	enum { INLINE_CAPACITY = 4 };
+
+	//  ,      
+	union {
+		char buf[INLINE_CAPACITY * sizeof(PDerivedType)];
+		void *align;
+	} inlineStorage;
+
+	//   -    
+	PDerivedType *items;
+
+	//   
+	int capacity;
+
+	//     
+	int first;
+
+	//   
+	int count;
+
+	//       
+	mutable unsigned canonicalId;
+
+	//  ,     .  - 
+	//      
+	mutable unsigned canonicalGeneration;
+
+	//   
+	PDerivedType *GetInlineItems() {
+		return (PDerivedType *)inlineStorage.buf;
+	}
+
+	//     ,   
+	//  
+	void Relayout();
 
 public:
 
+	//    
+	DerivedTypeList() 
+		: items(GetInlineItems()), capacity(INLINE_CAPACITY), first(INLINE_CAPACITY/4),
+		  count(0), canonicalId(0), canonicalGeneration(0) {
+	}
+
+	//  
+	DerivedTypeList( const DerivedTypeList &dtl );
+
+	//     
+	~DerivedTypeList();
+
+	//  
+	DerivedTypeList &operator=( const DerivedTypeList &dtl );
+
+	//    .   
+	//  ,     cv-
+	unsigned GetCanonicalId() const;
+
 	//  true,   
 	bool IsEmpty() const {
-		return derivedTypeList.empty();
+		return count == 0;
 	}
 
 	//       
 	bool IsFunction() const {
-		return !derivedTypeList.empty() && 
-			derivedTypeList[0]->GetDerivedTypeCode() == DerivedType::DT_FUNCTION_PROTOTYPE;
+		return count != 0 && 
+			items[first]->GetDerivedTypeCode() == DerivedType::DT_FUNCTION_PROTOTYPE;
 	}
 
 	//       
 	bool IsArray() const {
-		return !derivedTypeList.empty() && 
-			derivedTypeList[0]->GetDerivedTypeCode() == DerivedType::DT_ARRAY;
+		return count != 0 && 
+			items[first]->GetDerivedTypeCode() == DerivedType::DT_ARRAY;
 	}
 
 	//       
 	bool IsPointer() const {
-		return !derivedTypeList.empty() && 
-			derivedTypeList[0]->GetDerivedTypeCode() == DerivedType::DT_POINTER;
+		return count != 0 && 
+			items[first]->GetDerivedTypeCode() == DerivedType::DT_POINTER;
 	}
 
 	//         
 	bool IsPointerToMember() const {
-		return !derivedTypeList.empty() && 
-			derivedTypeList[0]->GetDerivedTypeCode() == DerivedType::DT_POINTER_TO_MEMBER;
+		return count != 0 && 
+			items[first]->GetDerivedTypeCode() == DerivedType::DT_POINTER_TO_MEMBER;
 	}
 
 	//       
 	bool IsReference() const {
-		return !derivedTypeList.empty() && 
-			derivedTypeList[0]->GetDerivedTypeCode() == DerivedType::DT_REFERENCE;
+		return count != 0 && 
+			items[first]->GetDerivedTypeCode() == DerivedType::DT_REFERENCE;
 	}
 
 
 	//    
 	int GetDerivedTypeCount() const { 
-		return derivedTypeList.size();
+		return count;
 	}
 
 	//     ,
 	//    ,   
 	const PDerivedType &GetDerivedType( int ix ) const {
-		INTERNAL_IF( ix < 0 || ix > derivedTypeList.size()-1 );
-		return derivedTypeList[ix];
+		INTERNAL_IF( ix < 0 || ix > count-1 );
+		return items[first + ix];
 	}
 
 	//     , 
 	//    ,  0
 	const PDerivedType operator[]( int ix ) const {
-		return (ix < 0 || ix > derivedTypeList.size()-1) ? 
-			PDerivedType(NULL) : derivedTypeList[ix];
+		return (ix < 0 || ix > count-1) ? PDerivedType(NULL) : items[first + ix];
 	}
 
 	//   
@@ -316,30 +469,41 @@ public:
 
 	//   
 	const PDerivedType GetTailDerivedType() const {
-		return IsEmpty() ? NULL : this->operator[](derivedTypeList.size()-1);
+		return IsEmpty() ? NULL : this->operator[](count-1);
 	}
 
 	//     
 	void PushHeadDerivedType( PDerivedType dt ) {
-		derivedTypeList.insert(derivedTypeList.begin(), dt);
+		canonicalGeneration = 0;
+		if( first == 0 )
+			Relayout();
+		new (items + first - 1) PDerivedType(dt);
+		first--, count++;
 	}
 
 	//     
 	void PopHeadDerivedType() {
-		derivedTypeList.erase(derivedTypeList.begin());
+		INTERNAL_IF( count == 0 );
+		canonicalGeneration = 0;
+		items[first].~PDerivedType();
+		first++, count--;
 	}
 
 	//     
 	//   ,     
 	//  
 	void AddDerivedType( PDerivedType dt ) {
-		derivedTypeList.push_back(dt);
+		canonicalGeneration = 0;
+		if( first + count == capacity )
+			Relayout();
+		new (items + first + count) PDerivedType(dt);
+		count++;
 	}
 
 	//      
 	void AddDerivedTypeList( const DerivedTypeList &dtl ) {
-		derivedTypeList.insert( derivedTypeList.end(),
-			dtl.derivedTypeList.begin(), dtl.derivedTypeList.end() );
+		for( int i = 0, n = dtl.count; i<n; i++ )
+			AddDerivedType( dtl.items[dtl.first + i] );
 	}
 
 	//      cv- 
@@ -349,7 +513,11 @@ public:
 
 	//     
 	void ClearDerivedTypeList() {
-		derivedTypeList.clear();
+		canonicalGeneration = 0;
+		for( int i = 0; i<count; i++ )
+			items[first + i].~PDerivedType();
+		count = 0;
+		first = capacity/4;
 	}
 };
 
@@ -386,10 +554,9 @@ public:
 		return size;
 	}
 
-	//    
-	void SetArraySize( int sz ) {
-		size = sz;
-	}
+	//    .     
+	// ,    
+	void SetArraySize( int sz );
 };
 
 
@@ -612,6 +779,89 @@ private:
 };
 
 
+//   .      
+// cv-        
+// ,       
+// .   -     ,
+//      
+class CanonicalTypeTable
+{
+	//    
+	struct NodeKey
+	{
+		//   
+		int code;
+
+		//    
+		const void *memberClass;
+
+		//  ,     
+		int value;
+
+		//   
+		unsigned tail;
+
+		//     
+		bool operator<( const NodeKey &k ) const {
+			if( code != k.code ) return code < k.code;
+			if( memberClass != k.memberClass ) return memberClass < k.memberClass;
+			if( value != k.value ) return value < k.value;
+			return tail < k.tail;
+		}
+	};
+
+	//   .    - 
+	static map<NodeKey, unsigned> nodes;
+
+	//   
+	static map<vector<unsigned>, unsigned> parametrLists;
+
+	// :       
+	static map<pair<const BaseType *, unsigned>, unsigned> types;
+
+	//   ,    
+	//  ,      
+	static unsigned generation;
+
+public:
+
+	//     
+	static unsigned GetDerivedTypeListId( const DerivedTypeList &dtl );
+
+	//     
+	static unsigned GetTypeId( const TypyziedEntity &te );
+
+	//   
+	static unsigned GetGeneration() {
+		return generation;
+	}
+
+	//     
+	static void IncreaseGeneration() {
+		generation++;
+	}
+
+	//    
+	static unsigned GetNodeCount() {
+		return nodes.size();
+	}
+
+	//    
+	static unsigned GetTypeCount() {
+		return types.size();
+	}
+
+	//    .    
+	//  , ..       
+	static void Clear() {
+		nodes.clear();
+		parametrLists.clear();
+		types.clear();
+		IncreaseGeneration();
+	}
+};
+
+
 //  -   . 
 //      ,  
 //   .       
@@ -713,6 +963,23 @@ public:
 		INTERNAL_IF( defaultValue != NULL );
 		defaultValue = dv;
 	}
+
+	//     . , 
+	//        
+	// , ..     
+	static unsigned GetDefaultValueGeneration() {
+		return defaultValueGeneration;
+	}
+
+	//     
+	static void IncreaseDefaultValueGeneration() {
+		defaultValueGeneration++;
+	}
+
+private:
+
+	//    
+	static unsigned defaultValueGeneration;
 };
 
 
@@ -1089,6 +1356,10 @@ private:
 	//   true,     
 	bool isHaveBody;
 
+	//      .   
+	//  ,    ,  
+	Position bodyBegin, bodyEnd;
+
 public:
 	//     
 	Function( const NRC::CharString &name, SymbolTable *entry, BaseType *bt,
@@ -1158,6 +1429,22 @@ public:
 		INTERNAL_IF( isHaveBody );
 		isHaveBody = true;
 	}
+
+	//     
+	void SetBodyRange( const Position &begin, const Position &end ) {
+		bodyBegin = begin;
+		bodyEnd = end;
+	}
+
+	//      
+	const Position &GetBodyBegin() const {
+		return bodyBegin;
+	}
+
+	//      
+	const Position &GetBodyEnd() const {
+		return bodyEnd;
+	}
 };
 
 
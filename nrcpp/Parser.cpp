@@ -28,6 +28,15 @@ using namespace ParserUtils;
 //  
 int OverflowController::counter = 0;
 
+
+//   .        
+// , ..      
+NRC::FreeListAllocator &Package::GetAllocator()
+{
+	static NRC::FreeListAllocator *allocator = new NRC::FreeListAllocator;
+	return *allocator;
+}
+
 //    
 int StatementParserImpl::OverflowStackController::deep = 0;
 
@@ -206,7 +215,7 @@ void DeclareParserImpl::Parse()
 
 	try {		
 		dr.ReadTypeSpecifierList();
-		tsl = dr.GetTypeSpecPackage().Release();
+		tsl = dr.ReleaseTypeSpecPackage().Release();
 				
 		//     '{',   "",
 		//    ,  
@@ -304,8 +313,12 @@ void DeclareParserImpl::Parse()
 						Function &fn = *const_cast<Function *>(
 							static_cast<const Function *>(dmak->GetIdentifier()) );
 
+						//       
+						if( theApp.IsDeclarationsOnly() )
+							SkipFunctionBody(lexicalAnalyzer, fn);
+
 						//      ,    
-						if( fn.IsHaveBody() )
+						else if( fn.IsHaveBody() )
 						{
 							theApp.Error(lexicalAnalyzer.LastLexem().GetPos(), 
 								"'%s' -     ",
@@ -765,11 +778,16 @@ void ClassParserImpl::Parse()
 	//   ,    , ..  
 	//  
 	clsType->uncomplete = false;
+	clsType->MakeHierarchyIndex();
 
 	//   -,    ,
 	// -  , - , -,  
 	GenerateSMF();
 
+	//    , ..  
+	//  ,     
+	AutoCastManager::ClearCache();
+
 	//   inline-
 	LoadInlineFunctions();
 
@@ -899,7 +917,7 @@ void ClassParserImpl::ParseMember( )
 
 	try {		
 		dr.ReadTypeSpecifierList();
-		tsl = dr.GetTypeSpecPackage().Release();	
+		tsl = dr.ReleaseTypeSpecPackage().Release();	
 				
 		//       ,  
 		//       PC_QUALIFIED_NAME,  
@@ -1002,18 +1020,25 @@ void ClassParserImpl::ParseMember( )
 						Function &fn = *const_cast<Function *>(
 							static_cast<const Function *>(dmak->GetIdentifier()) );
 
+						//       
+						if( theApp.IsDeclarationsOnly() )
+							SkipFunctionBody(lexicalAnalyzer, fn);
+
 						//        ,
 						//     ,   
-						lexicalAnalyzer.BackLexem();
-						FunctionBodyReader fbr(lexicalAnalyzer, false);
-						fbr.Read();
+						else
+						{
+							lexicalAnalyzer.BackLexem();
+							FunctionBodyReader fbr(lexicalAnalyzer, false);
+							fbr.Read();
+
+							// 
+							methodBodyList.push_back( FnContainerPair(&fn, fbr.GetLexemContainer()) );
+						}
 
 						//     ';'
 						if( lexicalAnalyzer.NextLexem() != ';' )
 							lexicalAnalyzer.BackLexem();
-
-						// 
-						methodBodyList.push_back( FnContainerPair(&fn, fbr.GetLexemContainer()) );
 						return;
 					}
 
@@ -1266,7 +1291,8 @@ void EnumParserImpl::Parse( )
 //     .   
 //   0
 FunctionParserImpl::FunctionParserImpl( LexicalAnalyzer &la, Function &fn )
-		:  lexicalAnalyzer(la) 
+		:  lexicalAnalyzer(la), retainedMark(LocalSymbolTable::GetRetainedCount()),
+		errorMark(theApp.GetErrorCount()), parsed(false)
 {	
 	fnBody = fn.IsClassMember() && static_cast<Method &>(fn).IsConstructor() ?
 		new ConstructorFunctionBody(fn, la.LastLexem().GetPos()) : 
@@ -1281,8 +1307,42 @@ FunctionParserImpl::FunctionParserImpl( LexicalAnalyzer &la, Function &fn )
 		fn.SetFunctionBody();	
 	
 	//    
-	GetScopeSystem().MakeNewSymbolTable( new FunctionSymbolTable(fn, fn.GetSymbolTableEntry()) );
+	fnSymbolTable = new FunctionSymbolTable(fn, fn.GetSymbolTableEntry());
+	GetScopeSystem().MakeNewSymbolTable( fnSymbolTable );
+
+	//          
+	if( theApp.IsStreaming() )
+		Operand::BeginFunctionPool();
+
+}
+
+
+//          . 
+//         ,  
+//    .      
+//   ,      .
+//     ,    
+void FunctionParserImpl::ReleaseFunction()
+{
+	if( !parsed || theApp.GetErrorCount() != errorMark )
+	{
+		LocalSymbolTable::ForgetRetained(retainedMark);
+		Operand::EndFunctionPool();
+		return;
+	}
 
+	//  catch-  catch-,  
+	//    ,    ,
+	//       
+	vector<const Identifier *> catchObjects;
+	fnBody->GetCatchObjects(catchObjects);
+	LocalSymbolTable::ReleaseFunctionScope(retainedMark, fnSymbolTable, catchObjects);
+	fnSymbolTable = NULL;
+
+	fnBody->ReleaseBody();
+	delete fnBody;
+	fnBody = NULL;
+	Operand::EndFunctionPool();
 }
 
 
@@ -1401,6 +1461,7 @@ void FunctionParserImpl::Parse()
 
 	//     ,   
 	PostBuildingChecks(*fnBody).DoChecks();
+	parsed = true;
 }
 
 
@@ -1602,7 +1663,7 @@ void StatementParserImpl::ReadCatchList()
 		cc->AddChildComponent( ParseBlock() );
 
 		//      
-		GetScopeSystem().DestroySymbolTable();
+		GetScopeSystem().DestroyLocalSymbolTable();
 		controller.SetCurrentConstruction( cc->GetParentConstruction() );
 		pCatch.Release();
 	}
@@ -1637,7 +1698,10 @@ CompoundConstruction *StatementParserImpl::ParseBlock( )
 			controller.SetCurrentConstruction(compound);
 			while( &GetCurrentSymbolTable() != &cur )
 			{
-				GetScopeSystem().DestroySymbolTable();
+				if( GetCurrentSymbolTable().IsLocalSymbolTable() )
+					GetScopeSystem().DestroyLocalSymbolTable();
+				else
+					GetScopeSystem().DestroySymbolTable();
 				INTERNAL_IF( GetCurrentSymbolTable().IsGlobalSymbolTable() );
 			}
 
@@ -1812,7 +1876,7 @@ BodyComponent *StatementParserImpl::ParseComponent( )
 		ValidCondition(doExpr, "do", compPos);
 		dwc->AddChildComponent( doChild.Release() );
 		controller.SetCurrentConstruction( dwc->GetParentConstruction() );
-		GetScopeSystem().DestroySymbolTable();
+		GetScopeSystem().DestroyLocalSymbolTable();
 		return pComp.Release();		//  do-
 
 	}
@@ -1834,7 +1898,7 @@ BodyComponent *StatementParserImpl::ParseComponent( )
 		//  		
 		fc->AddChildComponent( forChild );
 		controller.SetCurrentConstruction( fc->GetParentConstruction() );
-		GetScopeSystem().DestroySymbolTable();
+		GetScopeSystem().DestroyLocalSymbolTable();
 
 		//  for-
 		return pComp.Release();
@@ -1864,7 +1928,7 @@ BodyComponent *StatementParserImpl::ParseComponent( )
 		//  		
 		wc->AddChildComponent( whileChild );
 		controller.SetCurrentConstruction( wc->GetParentConstruction() );
-		GetScopeSystem().DestroySymbolTable();
+		GetScopeSystem().DestroyLocalSymbolTable();
 
 		//  while-
 		return pComp.Release();
@@ -1894,7 +1958,7 @@ BodyComponent *StatementParserImpl::ParseComponent( )
 		//  		
 		sc->AddChildComponent( switchChild );
 		controller.SetCurrentConstruction( sc->GetParentConstruction() );
-		GetScopeSystem().DestroySymbolTable();
+		GetScopeSystem().DestroyLocalSymbolTable();
 
 		//  swicth-
 		return pComp.Release();
@@ -1946,7 +2010,7 @@ BodyComponent *StatementParserImpl::ParseComponent( )
 
 		//   ,  				
 		controller.SetCurrentConstruction( ic->GetParentConstruction() );
-		GetScopeSystem().DestroySymbolTable();
+		GetScopeSystem().DestroyLocalSymbolTable();
 
 		//  if-
 		return pComp.Release();
@@ -1987,7 +2051,7 @@ BodyComponent *StatementParserImpl::ParseComponent( )
 		bool isMade = BodyMakerUtils::MakeLocalSymbolTable( controller.GetCurrentConstruction() );
 		CompoundConstruction *cc = ParseBlock();
 		if( isMade )
-			GetScopeSystem().DestroySymbolTable();
+			GetScopeSystem().DestroyLocalSymbolTable();
 		return cc;
 	}
 
@@ -2112,6 +2176,24 @@ Position ParserUtils::GetPackagePosition( const Package *pkg )
 }
 
 
+//          ,
+//     ,     .
+//       
+void ParserUtils::SkipFunctionBody( LexicalAnalyzer &la, Function &fn )
+{
+	Position begin = la.LastLexem().GetPos();
+
+	la.BackLexem();
+	FunctionBodyReader fbr(la, true);
+	fbr.Read();
+
+	if( fn.IsHaveBody() )
+		theApp.Error(begin, "'%s' -     ", fn.GetQualifiedName().c_str());
+	else
+		fn.SetFunctionBody(), fn.SetBodyRange(begin, fbr.GetEndPosition());
+}
+
+
 //    ,  
 CharString ParserUtils::PrintPackageTree( const NodePackage *np )
 {
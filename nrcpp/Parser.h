@@ -54,6 +54,11 @@ namespace ParserUtils
 	//   
 	Position GetPackagePosition( const Package *pkg );
 
+	//          ,
+	//     ,     .
+	//       
+	void SkipFunctionBody( LexicalAnalyzer &la, Function &fn );
+
 	//    ,  
 	CharString PrintPackageTree( const NodePackage  *pkg );
 }
@@ -62,13 +67,30 @@ namespace ParserUtils
 //    . 
 //  -       
 //   
-class Package
+class Package : public NRC::RefCounted
 {
 public:
 	//  ,    
 	virtual ~Package() {
 	}
 
+	//   .       
+	//  ,     
+	//  
+	static NRC::FreeListAllocator &GetAllocator();
+
+	//      
+	static void *operator new( size_t sz ) {
+		MemoryStatistics::Allocated( MemoryStatistics::MS_PACKAGES, sz );
+		return GetAllocator().Allocate(sz);
+	}
+
+	//     
+	static void operator delete( void *p, size_t sz ) {
+		MemoryStatistics::Freed( MemoryStatistics::MS_PACKAGES, sz );
+		GetAllocator().Free(p, sz);
+	}
+
 	//  
 	virtual bool IsLexemPackage() const {
 		return false;
@@ -142,13 +164,13 @@ class NodePackage : public Package
 	//   ,      
 	int packageID;
 
-	//   
-	vector<Package *> childPackageList;
+	//   .     ,
+	//     
+	SmallVector<Package *, 4> childPackageList;
 
 	//     
 	void ClearChildPackageList() {
-		for( vector<Package *>::iterator p = childPackageList.begin();
-			 p != childPackageList.end(); p++ )
+		for( Package **p = childPackageList.begin(); p != childPackageList.end(); p++ )
 			 delete *p, *p = NULL;	
 
 		childPackageList.clear();
@@ -233,7 +255,7 @@ public:
 			childPackageList.front()->GetPackageID() == PC_ERROR_CHILD_PACKAGE )
 			return;
 		
-		childPackageList.insert(childPackageList.begin(), pkg);
+		childPackageList.push_front(pkg);
 	}
 	
 	//     pid,      
@@ -267,8 +289,7 @@ public:
 			return;
 
 		cout << "---------------------\n";
-		for( vector<Package *>::const_iterator p = childPackageList.begin();
-			 p != childPackageList.end(); p++ )
+		for( Package *const *p = childPackageList.begin(); p != childPackageList.end(); p++ )
 				(*p)->Trace();
 
 		cout << "\n-------------------\n";
@@ -500,10 +521,25 @@ class FunctionParserImpl
 	//  ,     
 	FunctionBody *fnBody;
 
+	//   
+	FunctionSymbolTable *fnSymbolTable;
+
+	//       
+	//   
+	unsigned retainedMark;
+	int errorMark;
+
+	// true,    
+	bool parsed;
+
 	//       .
 	// 
 	void ReadContructorInitList( CtorInitListValidator &civl );
 
+	//         
+	//    
+	void ReleaseFunction();
+
 public:
 
 	//        
@@ -516,11 +552,14 @@ public:
 		//     ,    
 		//   
 		while( GetCurrentSymbolTable().IsLocalSymbolTable() )
-			GetScopeSystem().DestroySymbolTable();
+			GetScopeSystem().DestroyLocalSymbolTable();
 
 		//    
 		INTERNAL_IF( !GetCurrentSymbolTable().IsFunctionSymbolTable() );
 		GetScopeSystem().DestroySymbolTable();
+
+		if( theApp.IsStreaming() )
+			ReleaseFunction();
 	}
 
 	//   
@@ -568,7 +607,7 @@ class StatementParserImpl
 
 	//     
 	void MakeLST() {
-		GetScopeSystem().MakeNewSymbolTable( new LocalSymbolTable(GetCurrentSymbolTable()) );
+		GetScopeSystem().MakeNewSymbolTable( LocalSymbolTable::Create(GetCurrentSymbolTable()) );
 	}
 
 
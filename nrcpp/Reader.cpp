@@ -251,7 +251,11 @@ PNodePackage DeclaratorReader::ReadNextDeclarator()
 	nameRead = false;
 	initializatorList = NULL;		//   
 	ReadDeclarator();
-	return declPkg;
+
+	//   ,      
+	PNodePackage dcl = declPkg;
+	declPkg = NULL;
+	return dcl;
 }
 
 
@@ -611,7 +615,7 @@ PNodePackage DeclaratorReader::ReadFunctionPrototype()
 		canUndo = false;		
 
 		dr.ReadTypeSpecifierList();						//    
-		PNodePackage tsl = dr.GetTypeSpecPackage();
+		PNodePackage tsl = dr.ReleaseTypeSpecPackage();
 		if( tsl->IsNoChildPackages() )
 			throw lexicalAnalyzer.LastLexem();
 
@@ -711,7 +715,7 @@ PNodePackage DeclaratorReader::ReadThrowSpecType()
 	DeclaratorReader dr(DV_CAST_OPERATION, lexicalAnalyzer);
 	
 	dr.ReadTypeSpecifierList();						//    
-	PNodePackage tsl = dr.GetTypeSpecPackage();
+	PNodePackage tsl = dr.ReleaseTypeSpecPackage();
 	if( tsl->IsNoChildPackages() )
 		throw lexicalAnalyzer.LastLexem();
 
@@ -963,7 +967,7 @@ PNodePackage QualifiedConstructionReader::ReadOverloadOperator( )
   		dr.ReadTypeSpecifierList();
 		if( dr.GetTypeSpecPackage()->IsNoChildPackages() )
 			throw lastLxm;
-		ct->AddChildPackage( dr.GetTypeSpecPackage().Release() );	
+		ct->AddChildPackage( dr.ReleaseTypeSpecPackage().Release() );	
 		ct->AddChildPackage( dr.ReadNextDeclarator().Release() );						
 		op->AddChildPackage(ct.Release());
 
@@ -1045,6 +1049,7 @@ void FunctionBodyReader::ReadTryBlock()
 			if( sc )		//    ,   
 				continue;
 
+			endPos = lxm.GetPos();
 			lxm = lexicalAnalyzer.NextLexem();
 
 			//     'catch',  catch-
@@ -1135,7 +1140,10 @@ void FunctionBodyReader::Read()
 			sc--;
 			INTERNAL_IF( sc < 0 );
 			if( sc == 0 )
+			{
+				endPos = lxm.GetPos();
 				break;
+			}
 		}
 
 		else if( lxm == EOF )
@@ -1212,7 +1220,7 @@ void TypeExpressionReader::Read( bool fnParam, bool readTypeDecl )
 
 	try {
 		dr.ReadTypeSpecifierList();		
-		PNodePackage typeLst = dr.GetTypeSpecPackage();
+		PNodePackage typeLst = dr.ReleaseTypeSpecPackage();
 		int llc = typeLst->IsNoChildPackages() ? 0 : 
 			typeLst->GetLastChildPackage()->GetPackageID();
 			
@@ -1432,7 +1440,7 @@ PNodePackage ExpressionReader::ReadAbstractDeclarator( bool noError, Declaration
 
 	try {
 		dr.ReadTypeSpecifierList();
-		PNodePackage typeLst = dr.GetTypeSpecPackage();
+		PNodePackage typeLst = dr.ReleaseTypeSpecPackage();
 
 		//     ,     undoContainer
 		//  
@@ -1593,7 +1601,7 @@ void ExpressionReader::EvalExpr3( POperand &result )
 	POperand temp1(NULL), temp2(NULL);
 	StackOverflowCatcher soc;
 
-	EvalExpr4( result );
+	EvalBinaryExpr( result, 1 );
 	if( lastLxm == '?' )
 	{
 		NextLexem();
@@ -1606,7 +1614,7 @@ void ExpressionReader::EvalExpr3( POperand &result )
 			throw lastLxm;
 
 		NextLexem();		
-		EvalExpr4(temp2);
+		EvalBinaryExpr(temp2, 1);
 		
 		//   
 		result = TernaryExpressionCoordinator(result, temp1, temp2,
@@ -1615,221 +1623,104 @@ void ExpressionReader::EvalExpr3( POperand &result )
 }
 
 
-//  ||
-void ExpressionReader::EvalExpr4( POperand &result )
-{
-	POperand temp(NULL);
-	StackOverflowCatcher soc;	
-
-	EvalExpr5( result );
-	while( lastLxm == LOGIC_OR )
-	{
-		NextLexem();
-		EvalExpr5( temp );
-		
-		result = BinaryExpressionCoordinator<LogicalBinaryMaker>(result, temp, 
-			LOGIC_OR, lastLxm.GetPos()).Coordinate();
-	}
-}
-
-
-//  &&
-void ExpressionReader::EvalExpr5( POperand &result )
-{
-	POperand temp(NULL);
-	StackOverflowCatcher soc;	
-
-	EvalExpr6( result );
-	while( lastLxm == LOGIC_AND )
-	{
-		NextLexem();
-		EvalExpr6( temp );
-		
-		result = BinaryExpressionCoordinator<LogicalBinaryMaker>(result, temp, 
-			LOGIC_AND, lastLxm.GetPos()).Coordinate();
-	}
-}
-
-
-//  |
-void ExpressionReader::EvalExpr6( POperand &result )
-{
-	POperand temp(NULL);
-	StackOverflowCatcher soc;	
-
-	EvalExpr7( result );
-	while( lastLxm == '|' )
-	{
-		NextLexem();
-		EvalExpr7( temp );
-
-		result = BinaryExpressionCoordinator<IntegralBinaryMaker>(result, temp, 
-			'|', lastLxm.GetPos()).Coordinate();
-	}
-}
-
-
-//  '^'
-void ExpressionReader::EvalExpr7( POperand &result )
-{
-	POperand temp(NULL);
-	StackOverflowCatcher soc;	
-
-	EvalExpr8( result );
-	while( lastLxm == '^' )
-	{
-		NextLexem();
-		EvalExpr8( temp );		
-
-		result = BinaryExpressionCoordinator<IntegralBinaryMaker>(result, temp, 
-				'^', lastLxm.GetPos()).Coordinate();
-	}
-}
-
-
-//  '&'
-void ExpressionReader::EvalExpr8( POperand &result )
+//    ,  
+// ExpressionReader::EvalBinaryExpr.  0,  
+//    
+inline static int GetBinaryPrecedence( int op )
 {
-	POperand temp(NULL);
-	StackOverflowCatcher soc;	
-
-	EvalExpr9( result );
-	while( lastLxm == '&' )
-	{
-		NextLexem();
-		EvalExpr9( temp );		
-
-		result = BinaryExpressionCoordinator<IntegralBinaryMaker>(result, temp, 
-					'&', lastLxm.GetPos()).Coordinate();
-	}
-}
-
-	
-//  ==, !=
-void ExpressionReader::EvalExpr9( POperand &result )
-{
-	POperand temp(NULL);
-	StackOverflowCatcher soc;		
-
-	EvalExpr10( result );
-	while( lastLxm == EQUAL || lastLxm == NOT_EQUAL )
+	switch( op )
 	{
-		register int op = lastLxm;
-		NextLexem();
-		EvalExpr10( temp );		
-			
-		//   
-		result = BinaryExpressionCoordinator<ConditionBinaryMaker>(result, temp, 
-				op, lastLxm.GetPos()).Coordinate();
-	}	
-}
+	case LOGIC_OR:		return 1;
+	case LOGIC_AND:		return 2;
+	case '|':			return 3;
+	case '^':			return 4;
+	case '&':			return 5;
 
+	case EQUAL:
+	case NOT_EQUAL:		return 6;
 
-//  <=, <, >, >=
-void ExpressionReader::EvalExpr10( POperand &result )
-{
-	POperand temp(NULL);
-	StackOverflowCatcher soc;			
-	register int op;
+	case LESS_EQU:
+	case GREATER_EQU:
+	case '<':
+	case '>':			return 7;
 
-	EvalExpr11( result );
-	while( (op = lastLxm) == LESS_EQU || op == GREATER_EQU || 
-			op == '<' || op == '>' )
-	{
-		NextLexem();
-		EvalExpr11( temp );		
+	case LEFT_SHIFT:
+	case RIGHT_SHIFT:	return 8;
 
-		//   
-		result = BinaryExpressionCoordinator<ConditionBinaryMaker>(result, temp, 
-				op, lastLxm.GetPos()).Coordinate();
-	}			
-}
+	case '+':
+	case '-':			return 9;
 
+	case '*':
+	case '/':
+	case '%':			return 10;
 
-//  <<, >>
-void ExpressionReader::EvalExpr11( POperand &result )
-{
-	POperand temp(NULL);
-	StackOverflowCatcher soc;			
+	case DOT_POINT:
+	case ARROW_POINT:	return 11;
 
-	EvalExpr12( result );
-	while( lastLxm == RIGHT_SHIFT || lastLxm == LEFT_SHIFT )
-	{
-		register int op = lastLxm;
-		NextLexem();
-		EvalExpr12( temp );		
-
-		//   
-		result = BinaryExpressionCoordinator<IntegralBinaryMaker>(result, temp, 
-					op, lastLxm.GetPos()).Coordinate();
+	default:			return 0;
 	}
 }
 
 
-//  +, -
-void ExpressionReader::EvalExpr12( POperand &result )
+//      op   
+inline static POperand MakeBinaryExpression( const POperand &left, const POperand &right,
+							int op, const Position &pos )
 {
-	POperand temp(NULL);
-	StackOverflowCatcher soc;			
-
-	EvalExpr13( result );
-	while( lastLxm == '+' || lastLxm == '-' )
+	switch( op )
 	{
-		register int op = lastLxm;
-		NextLexem();
-		EvalExpr13( temp );	
-		
-		//      
-		result = op == '+' 
-			? 	BinaryExpressionCoordinator<PlusBinaryMaker>(result, temp, 
-					op, lastLxm.GetPos()).Coordinate()
-			:	BinaryExpressionCoordinator<MinusBinaryMaker>(result, temp, 
-					op, lastLxm.GetPos()).Coordinate();
+	//  
+	case LOGIC_OR:
+	case LOGIC_AND:
+		return BinaryExpressionCoordinator<LogicalBinaryMaker>(left, right, op, pos).Coordinate();
+
+	//  
+	case EQUAL:
+	case NOT_EQUAL:
+	case LESS_EQU:
+	case GREATER_EQU:
+	case '<':
+	case '>':
+		return BinaryExpressionCoordinator<ConditionBinaryMaker>(left, right, op, pos).Coordinate();
+
+	//     
+	case '+':
+		return BinaryExpressionCoordinator<PlusBinaryMaker>(left, right, op, pos).Coordinate();
+
+	case '-':
+		return BinaryExpressionCoordinator<MinusBinaryMaker>(left, right, op, pos).Coordinate();
+
+	//  '*'  '/'
+	case '*':
+	case '/':
+		return BinaryExpressionCoordinator<MulDivBinaryMaker>(left, right, op, pos).Coordinate();
+
+	//     		
+	case DOT_POINT:
+	case ARROW_POINT:
+		return BinaryExpressionCoordinator<PointerToMemberBinaryMaker>(left, right, 
+			op, pos).Coordinate();
+
+	//   '|', '^', '&', '%'   
+	default:
+		return BinaryExpressionCoordinator<IntegralBinaryMaker>(left, right, op, pos).Coordinate();
 	}
 }
 
 
-//  *, /, %
-void ExpressionReader::EvalExpr13( POperand &result )
+//    ||  .*, ->*
+void ExpressionReader::EvalBinaryExpr( POperand &result, int minPrec )
 {
-	POperand temp(NULL);
-	StackOverflowCatcher soc;		
-
-	EvalExpr14( result );
-	while( lastLxm == '*' || lastLxm == '/' || lastLxm == '%' )
-	{
-		register int op = lastLxm;
-
-		NextLexem();
-		EvalExpr14( temp );	
-		
-		//       '%',
-		//    '*'  '/'
-		result = op == '%' 
-			?	BinaryExpressionCoordinator<IntegralBinaryMaker>(result, temp, 
-					op, lastLxm.GetPos()).Coordinate()
-			:	BinaryExpressionCoordinator<MulDivBinaryMaker>(result, temp, 
-					op, lastLxm.GetPos()).Coordinate();		
-	}
-}
-
-
-//  .*, ->*
-void ExpressionReader::EvalExpr14( POperand &result )
-{
-	POperand temp(NULL);
-	StackOverflowCatcher soc;			
+	StackOverflowCatcher soc;
+	register int op, prec;
 
 	EvalExpr15( result );
-	while( lastLxm == DOT_POINT || lastLxm == ARROW_POINT )
+	while( (prec = GetBinaryPrecedence(op = lastLxm)) >= minPrec )
 	{
-		register int op = lastLxm;
-		NextLexem();
-		EvalExpr15( temp );	
+		POperand temp(NULL);
 
-		//      		
-		result = BinaryExpressionCoordinator<PointerToMemberBinaryMaker>(result, temp, 
-			op, lastLxm.GetPos()).Coordinate();
+		NextLexem();
+		EvalBinaryExpr( temp, prec + 1 );
+		result = MakeBinaryExpression(result, temp, op, lastLxm.GetPos());
 	}
 }
 
@@ -2030,8 +1921,7 @@ void ExpressionReader::EvalExpr16( POperand &result )
 					//        ']',
 					//       lastLxm,   
 					//   
-					if( !(temp.GetPos().col == lastLxm.GetPos().col &&
-						  temp.GetPos().line == lastLxm.GetPos().line) )
+					if( !(temp.GetPos() == lastLxm.GetPos()) )
 						BackLexem() ;
 					lastLxm = temp,
 					lexicalAnalyzer.SetLastLexem( temp );
@@ -102,6 +102,14 @@ public:
 		return tslPkg;
 	}
 
+	//     ,     
+	//        
+	PNodePackage ReleaseTypeSpecPackage() {
+		PNodePackage tsl = tslPkg;
+		tslPkg = NULL;
+		return tsl;
+	}
+
 	//   
 	const LexemContainer &GetLexemContainer() const {
 		return lexemContainer;
@@ -323,6 +331,9 @@ class FunctionBodyReader
 	// 
 	LexicalAnalyzer &lexicalAnalyzer;
 
+	//   '}' 
+	Position endPos;
+
 	
 	//  ,   try-
 	void ReadTryBlock();
@@ -346,6 +357,13 @@ public:
 	PLexemContainer GetLexemContainer() const {
 		return lexemContainer;
 	}
+
+	//    '}' .  try- ,
+	//   ,      , 
+	//       
+	const Position &GetEndPosition() const {
+		return endPos;
+	}
 };
 
 
@@ -566,38 +584,12 @@ private:
 	//  '?:'
 	void EvalExpr3( POperand &result );
 
-	//  ||
-	void EvalExpr4( POperand &result );
-
-	//  &&
-	void EvalExpr5( POperand &result );
-
-	//  |
-	void EvalExpr6( POperand &result );
-
-	//  '^'
-	void EvalExpr7( POperand &result );
-
-	//  '&'
-	void EvalExpr8( POperand &result );
-	
-	//  ==, !=
-	void EvalExpr9( POperand &result );
-
-	//  <=, <, >, >=
-	void EvalExpr10( POperand &result );
-
-	//  <<, >>
-	void EvalExpr11( POperand &result );
-
-	//  +, -
-	void EvalExpr12( POperand &result );
-
-	//  *, /, %
-	void EvalExpr13( POperand &result );
-
-	//  .*, ->*
-	void EvalExpr14( POperand &result );
+	//    ||  .*, ->*.   
+	//   :  ,  , 
+	//       minPrec, 
+	//       .   
+	// 
+	void EvalBinaryExpr( POperand &result, int minPrec );
 
 	//    '()'
 	void EvalExpr15( POperand &result );
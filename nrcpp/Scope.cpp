@@ -11,6 +11,17 @@ using namespace NRC;
 
 
 
+//    
+unsigned SymbolTable::generation = 0;
+
+//     
+unsigned SymbolTable::lastStamp = 0;
+
+//   using-.   ,   
+//     
+unsigned GeneralSymbolTable::usingGeneration = 1;
+
+
 // 
 bool IdentifierListFunctor::operator() ( const IdentifierList &il ) const
 {
@@ -20,67 +31,207 @@ bool IdentifierListFunctor::operator() ( const IdentifierList &il ) const
 
 //  
 HashTab::HashTab( unsigned htsz )
-	: size(htsz)
-{
-	table = new ListOfIdentifierList[size];
-}
-
-
-//   
-HashTab::~HashTab()
+	: count(0)
 {
-	delete [] table;
+	unsigned size = 8;
+	while( size < htsz )
+		size <<= 1;
+	table.resize(size);
+	MemoryStatistics::Allocated( MemoryStatistics::MS_SYMBOL_TABLES, size * sizeof(Entry) );
 }
 
 
-//  ,    
-unsigned HashTab::Hash( const CharString &key ) const
+//   (FNV-1a),   -  .
+//     ,     
+//     
+unsigned HashTab::Hash( const CharString &key )
 {
 	register const char *p;
-	register unsigned int h = 0, g;
+	register unsigned int h = 2166136261U;
 		
 	for(p = key.c_str(); *p != '\0'; p++)
-		if(g = (h = (h << 4) + *p) & 0xF0000000)
-			h ^= g >> 24 ^ g;
+		h = (h ^ (unsigned char)*p) * 16777619U;
 		
-	return h % size;
+	return h;
 }
 
 
-//  
-IdentifierList *HashTab::Find( const CharString &key ) const
+//     key,   ,  
+//   
+HashTab::Entry &HashTab::Probe( const CharString &key, unsigned h ) const
 {
-	ListOfIdentifierList &lst = table[Hash(key)];
-	ListOfIdentifierList ::iterator p = 
-		find_if( lst.begin(), lst.end(), IdentifierListFunctor(key) );
+	register unsigned mask = table.size() - 1;
+	for( register unsigned i = h & mask; ; i = (i + 1) & mask )
+	{
+		const Entry &e = table[i];
+		if( e.ids.empty() || 
+			(e.hash == h && e.ids.front()->GetName() == key) )
+			return const_cast<Entry &>(e);
+	}
+}
+
 
-	return p == lst.end() ? NULL : &*p;
+//         
+void HashTab::Grow()
+{
+	vector<Entry> old(table.size() * 2);
+	old.swap(table);
+	MemoryStatistics::Allocated( MemoryStatistics::MS_SYMBOL_TABLES, table.size() * sizeof(Entry) );
+
+	//  -   ,   
+	//   
+	register unsigned mask = table.size() - 1;
+	for( vector<Entry>::iterator p = old.begin(); p != old.end(); p++ )
+		if( !(*p).ids.empty() )
+		{
+			unsigned i = (*p).hash & mask;
+			while( !table[i].ids.empty() )
+				i = (i + 1) & mask;
+
+			table[i].hash = (*p).hash;
+			table[i].ids.swap( (*p).ids );
+		}
+
+	MemoryStatistics::Freed( MemoryStatistics::MS_SYMBOL_TABLES, old.size() * sizeof(Entry) );
+}
+
+
+//  
+const IdentifierVector *HashTab::Find( const CharString &key ) const
+{
+	const Entry &e = Probe(key, Hash(key));
+	return e.ids.empty() ? NULL : &e.ids;
 }
 
 
 //    
 unsigned HashTab::Insert( const Identifier *id )
 {
-	ListOfIdentifierList &lst = table[ Hash(id->GetName()) ];
-	ListOfIdentifierList::iterator p = find_if(lst.begin(), lst.end(), 
-		IdentifierListFunctor(id->GetName()) );
+	unsigned h = Hash(id->GetName());
+	Entry *e = &Probe(id->GetName(), h);
 
-	//     ,    , 
-	//     
-	if( p == lst.end() )
+	//    ,   , 
+	//  ,   
+	if( e->ids.empty() )
 	{
-		IdentifierList il;
-		il.push_back(id);
-		lst.push_back( il );		
-		return 1;
+		if( (count + 1) * 100 > table.size() * MAX_LOAD_PERCENT )
+			Grow(), e = &Probe(id->GetName(), h);
+
+		e->hash = h;
+		count++;
 	}
-	
-	//      
-	else	
+
+	e->ids.push_back(id);
+	return e->ids.size();
+}
+
+
+//        
+//      
+void HashTab::GetProbeStatistics( unsigned &longest, double &avgProbe ) const
+{
+	unsigned mask = table.size() - 1;
+	double total = 0;
+
+	longest = 0;
+	for( unsigned i = 0; i<table.size(); i++ )
+		if( !table[i].ids.empty() )
+		{
+			//       
+			unsigned probe = ((i - table[i].hash) & mask) + 1;
+			total += probe;
+			if( probe > longest )
+				longest = probe;
+		}
+
+	avgProbe = count ? total / count : 0;
+}
+
+
+//   
+void HashTab::Clear()
+{
+	for( vector<Entry>::iterator p = table.begin(); p != table.end(); p++ )
+		(*p).ids.clear();
+	count = 0;
+}
+
+
+//  
+const IdentifierVector *LocalIdentifierTable::Find( const CharString &key ) const
+{
+	if( hashTab != NULL )
+		return hashTab->Find(key);
+
+	for( unsigned i = 0; i<used; i++ )
+		if( names[i].front()->GetName() == key )
+			return &names[i];
+	return NULL;
+}
+
+
+//    
+void LocalIdentifierTable::Insert( const Identifier *id )
+{
+	if( hashTab != NULL )
+	{
+		hashTab->Insert(id);
+		return;
+	}
+
+	for( unsigned i = 0; i<used; i++ )
+		if( names[i].front()->GetName() == id->GetName() )
+		{
+			names[i].push_back(id);
+			return;
+		}
+
+	//  ,   ,    -
+	if( used == LOCAL_SCOPE_LINEAR_LIMIT )
 	{
-		(*p).push_back(id);	
-		return (*p).size();
-	}	
+		hashTab = new HashTab(DEFAULT_LOCAL_HASHTAB_SIZE);
+		for( unsigned i = 0; i<used; i++ )
+		{
+			for( IdentifierVector::iterator p = names[i].begin(); p != names[i].end(); p++ )
+				hashTab->Insert(*p);
+			names[i].clear();
+		}
+
+		used = 0;
+		hashTab->Insert(id);
+		return;
+	}
+
+	if( used == names.size() )
+		names.push_back( IdentifierVector() );
+	names[used++].push_back(id);
+}
+
+
+//    
+void LocalIdentifierTable::GetIdentifiers( vector<const Identifier *> &out ) const
+{
+	if( hashTab != NULL )
+	{
+		for( unsigned i = 0; i<hashTab->GetSize(); i++ )
+			if( const IdentifierVector *il = hashTab->GetSlot(i) )
+				out.insert( out.end(), il->begin(), il->end() );
+		return;
+	}
+
+	for( unsigned i = 0; i<used; i++ )
+		out.insert( out.end(), names[i].begin(), names[i].end() );
+}
+
+
+//  
+void LocalIdentifierTable::Clear()
+{
+	for( unsigned i = 0; i<used; i++ )
+		names[i].clear();
+	used = 0;
+	delete hashTab;
+	hashTab = NULL;
 }
 
 
@@ -88,8 +239,10 @@ unsigned HashTab::Insert( const Identifier *id )
 //   
 void GeneralSymbolTable::AddUsingNamespace( NameSpace *ns ) 
 {
+	//   ,   ,
+	//  
 	if( usingList.HasSymbolTable(ns) < 0 )
-		usingList.AddSymbolTable(ns);
+		usingList.AddSymbolTable(ns), IncreaseGeneration(), usingGeneration++;
 }
 
 
@@ -97,61 +250,80 @@ void GeneralSymbolTable::AddUsingNamespace( NameSpace *ns )
 //   
 void FunctionSymbolTable::AddUsingNamespace( NameSpace *ns ) 
 {
+	//     , 
+	//    
 	if( usingList.HasSymbolTable(ns) < 0 )
-		usingList.AddSymbolTable(ns);
+		usingList.AddSymbolTable(ns), IncreaseStamp(), closureGeneration = 0;
 }
 
 
-//  ,       
-//  .    NameSpace
-bool GeneralSymbolTable::FindSymbolWithUsing( const CharString &name,
-					SymbolTableList &tested, IdentifierList &out ) const
-{	
-	if( IdentifierList *il = hashTab->Find(name) )
-		out.insert( out.end(), il->begin(), il->end() );
-	
-	//     ,   
-	for( int i = 0; i<usingList.GetSymbolTableCount(); i++ )
+//   using-  ul,  self
+//    .     
+//  , ..    ,     
+//  
+void GeneralSymbolTable::BuildUsingClosure( const SymbolTableList &ul, 
+		const SymbolTable *self, UsingClosure &closure )
+{
+	for( int i = 0; i<ul.GetSymbolTableCount(); i++ )
 	{
-		//        ,
+		const GeneralSymbolTable *ns = dynamic_cast<const NameSpace *>(ul[i]);
+		INTERNAL_IF( ns == NULL );
+
 		//  ,      
-		if( tested.HasSymbolTable( usingList[i] ) >= 0 )
+		if( ns == self ||
+			find(closure.begin(), closure.end(), ns) != closure.end() )
 			continue;
 
-		tested.AddSymbolTable( usingList[i] );
-		const GeneralSymbolTable *ns = dynamic_cast<const NameSpace *>(usingList[i]);
-		INTERNAL_IF( ns == NULL );
+		closure.push_back(ns);
+		BuildUsingClosure(ns->usingList, self, closure);
+	}
+}
 
-		//   ,   out
-		ns->FindSymbolWithUsing(name, tested, out);			
+
+//   using-,    
+const UsingClosure &GeneralSymbolTable::GetUsingClosure() const
+{
+	if( closureGeneration != usingGeneration )
+	{
+		usingClosure.clear();
+		BuildUsingClosure(usingList, this, usingClosure);
+		closureGeneration = usingGeneration;
 	}
 
-	//    
-	return !out.empty();
+	return usingClosure;
 }
 
 
 //        ,
 //          
-//       (using).  
-//  ,     .. 2 
-//        .    
+//        (using), 
+//       .    
 //    -  false
 bool GeneralSymbolTable::FindSymbol( const NRC::CharString &name, 
 			IdentifierList &out ) const 
 {
-	SymbolTableList tested;	
-	return FindSymbolWithUsing(name, tested, out);
+	if( const IdentifierVector *il = hashTab->Find(name) )
+		out.insert( out.end(), il->begin(), il->end() );
+	
+	if( usingList.IsEmpty() )
+		return CompilerStatistics::findSymbol.Count(!out.empty());
+
+	const UsingClosure &uc = GetUsingClosure();
+	for( UsingClosure::const_iterator p = uc.begin(); p != uc.end(); p++ )
+		if( const IdentifierVector *il = (*p)->hashTab->Find(name) )
+			out.insert( out.end(), il->begin(), il->end() );
+
+	return CompilerStatistics::findSymbol.Count(!out.empty());
 }
 
 
 //     using-,   ( ) 
 bool GeneralSymbolTable::FindInScope( const NRC::CharString &name, IdentifierList &out ) const 
 {		
-	if( IdentifierList *il = hashTab->Find(name) )
+	if( const IdentifierVector *il = hashTab->Find(name) )
 		out.insert( out.end(), il->begin(), il->end() );
 
-	return !out.empty();	
+	return CompilerStatistics::findInScope.Count(!out.empty());	
 }
 
 
@@ -159,6 +331,7 @@ bool GeneralSymbolTable::FindInScope( const NRC::CharString &name, IdentifierLis
 bool GeneralSymbolTable::InsertSymbol( Identifier *id ) 
 {
 	unsigned icnt = hashTab->Insert(id);
+	IncreaseGeneration();
 
 	//   - ,    ,
 	//      -
@@ -168,39 +341,35 @@ bool GeneralSymbolTable::InsertSymbol( Identifier *id )
 }
 
 
-//  ,       
-//  .    NameSpace
-bool FunctionSymbolTable::FindSymbolWithUsing( const CharString &name,
-							SymbolTableList &tested, IdentifierList &out ) const
+//   using-,    
+const UsingClosure &FunctionSymbolTable::GetUsingClosure() const
 {
-	FindInScope(name, out);
-	
-	//     ,   
-	for( int i = 0; i<usingList.GetSymbolTableCount(); i++ )
+	if( closureGeneration != GeneralSymbolTable::GetUsingGeneration() )
 	{
-		//        ,
-		//  ,      
-		if( tested.HasSymbolTable( usingList[i] ) >= 0 )
-			continue;
-
-		tested.AddSymbolTable( usingList[i] );
-		const GeneralSymbolTable *ns = dynamic_cast<const NameSpace *>(usingList[i]);
-		INTERNAL_IF( ns == NULL );
-		ns->FindSymbolWithUsing(name, tested, out);		
+		usingClosure.clear();
+		GeneralSymbolTable::BuildUsingClosure(usingList, this, usingClosure);
+		closureGeneration = GeneralSymbolTable::GetUsingGeneration();
 	}
 
-	//  -  - true
-	return !out.empty();
+	return usingClosure;
 }
 
 
 //      ,     
 //          
-//       (using). 
+//        (using). 
 bool FunctionSymbolTable::FindSymbol( const NRC::CharString &name, IdentifierList &out ) const
 {
-	SymbolTableList tested;	
-	return FindSymbolWithUsing(name, tested, out);
+	FindInScope(name, out);
+	if( usingList.IsEmpty() )
+		return CompilerStatistics::findSymbol.Count(!out.empty());
+
+	const UsingClosure &uc = GetUsingClosure();
+	for( UsingClosure::const_iterator p = uc.begin(); p != uc.end(); p++ )
+		(*p)->FindInScope(name, out);
+
+	//  -  - true
+	return CompilerStatistics::findSymbol.Count(!out.empty());
 }
 
 
@@ -208,10 +377,8 @@ bool FunctionSymbolTable::FindSymbol( const NRC::CharString &name, IdentifierLis
 //     
 bool FunctionSymbolTable::FindInScope( const NRC::CharString &name, IdentifierList &out ) const
 {
-	ListOfIdentifierList::const_iterator p = 
-		find_if( localIdList.begin(), localIdList.end(), IdentifierListFunctor(name) );
-	if( p != localIdList.end() )
-		out.insert( out.end(), (*p).begin(), (*p).end() );
+	if( const IdentifierVector *il = localIdList.Find(name) )
+		out.insert( out.end(), il->begin(), il->end() );
 	
 	//     
 	const FunctionParametrList &fpl = pFunction.GetFunctionPrototype().GetParametrList();
@@ -220,28 +387,15 @@ bool FunctionSymbolTable::FindInScope( const NRC::CharString &name, IdentifierLi
 	//   ,     
 	if( pix >= 0 )	
 		out.push_back( &*fpl[pix] );
-	return !out.empty();
+	return CompilerStatistics::findInScope.Count(!out.empty());
 }
 
 
 //   
 bool FunctionSymbolTable::InsertSymbol( Identifier *id )
 {
-	ListOfIdentifierList::iterator p = 
-		find_if( localIdList.begin(), localIdList.end(), IdentifierListFunctor(id->GetName()) );
-
-	//      ,   
-	if( p != localIdList.end() )
-		(*p).push_back(id);
-
-	//    
-	else
-	{
-		IdentifierList il;
-		il.push_back(id);
-		localIdList.push_back(il);
-	}
-	
+	IncreaseStamp();
+	localIdList.Insert(id);
 	return true;	
 }
 
@@ -252,68 +406,212 @@ void FunctionSymbolTable::ClearTable()
 }
 
 
-//  	
-bool LocalSymbolTable::FindSymbol( const NRC::CharString &name, 
-					IdentifierList &out ) const 
+//    
+vector<LocalSymbolTable *> LocalSymbolTable::freeList;
+
+
+//    
+vector<LocalSymbolTable *> LocalSymbolTable::retainedList;
+
+
+//    ,     
+//   
+LocalSymbolTable *LocalSymbolTable::Create( const SymbolTable &pst )
 {
-	if( !table )
-		return false;
+	if( freeList.empty() )
+		return new LocalSymbolTable(pst);
+
+	LocalSymbolTable *lst = freeList.back();
+	freeList.pop_back();
+	lst->parentST = &pst;
 
-	ListOfIdentifierList::const_iterator p = 
-			find_if( table->begin(), table->end(), IdentifierListFunctor(name) );
-	if( p != table->end() )
+	//  ,      
+	lst->IncreaseStamp();
+	return lst;
+}
+
+
+//        
+void LocalSymbolTable::Release( LocalSymbolTable *lst )
+{
+	//     ,    
+	//   ,    
+	if( lst->retained )
 	{
-		out.insert( out.end(), (*p).begin(), (*p).end() );
-		return true;
+		if( lst->parentST->IsLocalSymbolTable() )
+			const_cast<LocalSymbolTable *>(
+				static_cast<const LocalSymbolTable *>(lst->parentST))->retained = true;
+		if( theApp.IsStreaming() )
+			retainedList.push_back(lst);
+		return;
 	}
 
-	return false;
+	INTERNAL_IF( !lst->table.IsEmpty() );
+	freeList.push_back(lst);
 }
 
 
-//   
-bool LocalSymbolTable::InsertSymbol( Identifier *id ) 
+//   
+void LocalSymbolTable::ReleaseFreeList()
 {
-	//    ,  
-	if( table == NULL )
-		table = new ListOfIdentifierList;
-	ListOfIdentifierList::iterator p = 
-		find_if( table->begin(), table->end(), IdentifierListFunctor(id->GetName()) );
+	for( vector<LocalSymbolTable *>::iterator p = freeList.begin(); p != freeList.end(); p++ )
+		delete *p;
+	freeList.clear();
+}
 
-	//      ,   
-	if( p != table->end() )
-		(*p).push_back(id);
 
-	//    
-	else
+//      st.  false, 
+//    ,      :
+// ,   ,    .
+//    owned      
+//  ,   
+static bool CollectReleasableLocals( const LocalIdentifierTable &lit, const SymbolTable &st, 
+		const vector<const Identifier *> &owned, vector<const Identifier *> &out )
+{
+	unsigned first = out.size();
+	lit.GetIdentifiers(out);
+	for( unsigned i = first; i<out.size(); )
 	{
-		IdentifierList il;
-		il.push_back(id);
-		table->push_back(il);
+		if( find(owned.begin(), owned.end(), out[i]) != owned.end() )
+		{
+			out.erase(out.begin() + i);
+			continue;
+		}
+
+		const ::Object *obj = dynamic_cast<const ::Object *>(out[i]);
+		if( obj == NULL || &obj->GetSymbolTableEntry() != &st ||
+			!(obj->GetStorageSpecifier() == ::Object::SS_AUTO ||
+			  obj->GetStorageSpecifier() == ::Object::SS_REGISTER ||
+			  obj->GetStorageSpecifier() == ::Object::SS_NONE) )
+			return false;
+		i++;
 	}
 
 	return true;
 }
 
 
+//        
+bool LocalSymbolTable::ReleaseFunctionScope( unsigned mark, FunctionSymbolTable *fst,
+		const vector<const Identifier *> &owned )
+{
+	INTERNAL_IF( mark > retainedList.size() || fst == NULL );
+	vector<const Identifier *> ids;
+	bool releasable = CollectReleasableLocals(fst->GetIdentifierTable(), *fst, owned, ids);
+	for( unsigned i = mark; releasable && i<retainedList.size(); i++ )
+		releasable = CollectReleasableLocals(
+			retainedList[i]->GetIdentifierTable(), *retainedList[i], owned, ids);
+
+	if( releasable )
+	{
+		for( vector<const Identifier *>::iterator p = ids.begin(); p != ids.end(); p++ )
+			delete const_cast<Identifier *>(*p);
+		for( unsigned i = mark; i<retainedList.size(); i++ )
+			delete retainedList[i];
+		delete fst;
+
+		//  ,    , 
+		//    :  
+		//   ,      
+	}
+
+	retainedList.resize(mark);
+	return releasable;
+}
+
+
+//  	
+bool LocalSymbolTable::FindSymbol( const NRC::CharString &name, 
+					IdentifierList &out ) const 
+{
+	if( const IdentifierVector *il = table.Find(name) )
+	{
+		out.insert( out.end(), il->begin(), il->end() );
+		return CompilerStatistics::findSymbol.Count(true);
+	}
+
+	return CompilerStatistics::findSymbol.Count(false);
+}
+
+
+//   
+bool LocalSymbolTable::InsertSymbol( Identifier *id ) 
+{
+	IncreaseStamp();
+	table.Insert(id);
+	retained = true;
+	return true;
+}
+
+
 //      , 
 //    , ..     
 //   -   
 //  .  .  -   
-bool Scope::DeepSearch( const CharString &name, IdentifierList &out ) const
+bool Scope::DeepSearch( const CharString &name, IdentifierList &out, LookupStamp *ls ) const
 {	
+	// ,     ,  
+	map<string, SearchResult> &results = searchCache[symbolTableStack.back()];
+	map<string, SearchResult>::iterator p = results.find(name);
+	if( p == results.end() )
+		p = results.insert( map<string, SearchResult>::value_type(name, SearchResult()) ).first;
+
+	else if( IsActual((*p).second.stamp) )
+	{
+		const IdentifierList &found = (*p).second.found;
+		out.insert( out.end(), found.begin(), found.end() );
+		if( ls != NULL )
+			*ls = (*p).second.stamp;
+		return CompilerStatistics::deepSearch.Count(!found.empty());
+	}
+
+	//  ,  .     
+	//   ,        
+	//  
+	SearchResult &sr = (*p).second;
+	sr.found.clear();
+	sr.stamp.chain.clear();
+	sr.stamp.generation = SymbolTable::GetGeneration();
+
 	//     
 	list<SymbolTable *>::const_iterator i = symbolTableStack.end();	
 	for( i--; ; i-- )	
 	{
-		if( (*i)->FindSymbol(name, out) )
-			return true;
+		sr.stamp.chain.push_back( 
+			pair<const SymbolTable *, unsigned>(*i, (*i)->GetStamp()) );
+		if( (*i)->FindSymbol(name, sr.found) )
+			break;
 	
 		if( i == symbolTableStack.begin() )
 			break;
 	}
 
-	return false;
+	out.insert( out.end(), sr.found.begin(), sr.found.end() );
+	if( ls != NULL )
+		*ls = sr.stamp;
+	return CompilerStatistics::deepSearch.Count(!sr.found.empty());
+}
+
+
+// true,       ls 
+//     .   
+//      ,    
+//   , ..      
+bool Scope::IsActual( const LookupStamp &ls ) const
+{
+	if( ls.generation != SymbolTable::GetGeneration() ||
+		ls.chain.size() > symbolTableStack.size() )
+		return false;
+
+	list<SymbolTable *>::const_iterator i = symbolTableStack.end();	
+	for( unsigned j = 0; j < ls.chain.size(); j++ )
+	{
+		i--;
+		if( *i != ls.chain[j].first || (*i)->GetStamp() != ls.chain[j].second )
+			return false;
+	}
+
+	return true;
 }
 
 
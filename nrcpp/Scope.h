@@ -39,35 +39,144 @@ public:
 };
 
 
-// -
+//   .   - 
+//      
+typedef vector<const Identifier *> IdentifierVector;
+
+
+// -   .   -  ,
+//    .   
+//    MAX_LOAD_PERCENT ,   
 class HashTab
 {
-	//   
-	ListOfIdentifierList *table;
+	//  .  ,     
+	struct Entry
+	{
+		//  - ,     
+		unsigned hash;
+
+		//  
+		IdentifierVector ids;
+
+		//  
+		Entry() : hash(0) {
+		}
+	};
+
+	//     
+	enum { MAX_LOAD_PERCENT = 70 };
+
+	//  
+	vector<Entry> table;
+
+	//   
+	unsigned count;
 
-	//  
-	unsigned int size;
+	//  ,   -  
+	static unsigned Hash( const CharString &key );
 
-	//  ,    
-	unsigned Hash( const CharString &key ) const;
+	//     key,   ,  
+	//   
+	Entry &Probe( const CharString &key, unsigned h ) const;
+
+	//         
+	void Grow();
 
 public:
-	//  
+	//  , htsz -  , 
+	//   
 	HashTab( unsigned htsz );
 
-	//   
-	~HashTab();
+	//       
+	~HashTab() {
+		MemoryStatistics::Freed( MemoryStatistics::MS_SYMBOL_TABLES, table.size() * sizeof(Entry) );
+	}
 
 	//  
-	IdentifierList *Find( const CharString &key ) const;
+	const IdentifierVector *Find( const CharString &key ) const;
 
-	//    
+	//    ,    
+	//     
 	unsigned Insert( const Identifier *id );
 
 	//   
-	void Clear() {
-		table->clear();
+	void Clear();
+
+	//      
+	unsigned GetCount() const {
+		return count;
+	}
+
+	//   
+	unsigned GetSize() const {
+		return table.size();
+	}
+
+	//    
+	double GetLoadFactor() const {
+		return (double)count / table.size();
+	}
+
+	//     ,    - NULL
+	const IdentifierVector *GetSlot( unsigned ix ) const {
+		INTERNAL_IF( ix >= table.size() );
+		return table[ix].ids.empty() ? NULL : &table[ix].ids;
+	}
+
+	//        
+	//      
+	void GetProbeStatistics( unsigned &longest, double &avgProbe ) const;
+};
+
+
+//       .
+//    ,       , 
+//   LOCAL_SCOPE_LINEAR_LIMIT    -.
+//     ,   
+//     
+class LocalIdentifierTable
+{
+	//  ,   used 
+	vector<IdentifierVector> names;
+
+	//     names
+	unsigned used;
+
+	// -,    
+	HashTab *hashTab;
+
+public:
+	//  
+	LocalIdentifierTable() 
+		: used(0), hashTab(NULL) {
 	}
+
+	//  -
+	~LocalIdentifierTable() {
+		delete hashTab;
+	}
+
+	//  
+	const IdentifierVector *Find( const CharString &key ) const;
+
+	//    
+	void Insert( const Identifier *id );
+
+	//  
+	void Clear();
+
+	//    
+	void GetIdentifiers( vector<const Identifier *> &out ) const;
+
+	//   
+	bool IsEmpty() const {
+		return used == 0 && hashTab == NULL;
+	}
+
+private:
+	//  , ..   -
+	LocalIdentifierTable( const LocalIdentifierTable & );
+	void operator=( const LocalIdentifierTable & );
 };
 
 
@@ -77,7 +186,48 @@ public:
 // ,     
 class SymbolTable
 {
+	//    .   
+	// ,    :  , 
+	//  using-   .  
+	//     ,     
+	static unsigned generation;
+
+	//    .   , 
+	// ,    ,      
+	static unsigned lastStamp;
+
+	//  ,      
+	unsigned stamp;
+
+protected:
+	//     
+	SymbolTable() 
+		: stamp(++lastStamp) {
+	}
+
+	//      ,   
+	//      
+	void IncreaseStamp() {
+		stamp = ++lastStamp;
+	}
+
 public:
+	//      
+	static unsigned GetGeneration() {
+		return generation;
+	}
+
+	//     ,  
+	//    
+	static void IncreaseGeneration() {
+		generation++;
+	}
+
+	//   
+	unsigned GetStamp() const {
+		return stamp;
+	}
+
 	//  .      
 	//     ,    .
 	//  true,      
@@ -202,6 +352,14 @@ public:
 };
 
 
+//  
+class GeneralSymbolTable;
+
+//   using- :  
+// ,     ,  
+typedef vector<const GeneralSymbolTable *> UsingClosure;
+
+
 //   ,    
 //    
 class GeneralSymbolTable : public SymbolTable
@@ -213,6 +371,17 @@ class GeneralSymbolTable : public SymbolTable
 	//    ,   
 	SymbolTableList	usingList;
 
+	//  using-,      
+	//     using-
+	mutable UsingClosure usingClosure;
+
+	//   using-,    
+	mutable unsigned closureGeneration;
+
+	//   using-,   
+	// using-    
+	static unsigned usingGeneration;
+
 	//     ,  
 	//   
 	const SymbolTable *parent;
@@ -222,11 +391,16 @@ class GeneralSymbolTable : public SymbolTable
 	// ,     , 
 	//   . , ..  
 	//  NameSpace  TranslationUnit
-	GeneralSymbolTable( unsigned htsz, SymbolTable *pp ) {
+	GeneralSymbolTable( unsigned htsz, SymbolTable *pp ) : closureGeneration(0) {
 		parent = pp == NULL ? this : pp;
 		hashTab = new HashTab(htsz);		
 	}
 
+	//  -
+	~GeneralSymbolTable() {
+		delete hashTab;
+	}
+
 	//     
 	friend class NameSpace;
 	
@@ -255,12 +429,24 @@ public:
 		return usingList;
 	}
 
+	//   using-,    
+	const UsingClosure &GetUsingClosure() const;
+
+	//   using-  ul,  self
+	//    
+	static void BuildUsingClosure( const SymbolTableList &ul, 
+		const SymbolTable *self, UsingClosure &closure );
+
+	//     using-
+	static unsigned GetUsingGeneration() {
+		return usingGeneration;
+	}
+
 	//        ,
 	//          
-	//       (using).  
-	//  ,     .. 2 
-	//        .    
-	//    -    name  NULL 
+	//        (using), 
+	//       .    
+	//    -  false
 	virtual bool FindSymbol( const NRC::CharString &name, IdentifierList &out ) const;
 
 
@@ -271,13 +457,15 @@ public:
 	//   
 	virtual bool InsertSymbol( Identifier *id ) ;
 
-	//  ,       
-	//  .    NameSpace
-	bool FindSymbolWithUsing( const CharString &name,
-							 SymbolTableList &tested, IdentifierList &out ) const;
 	//   
 	virtual void ClearTable() {
 		hashTab->Clear();
+		IncreaseGeneration();
+	}
+
+	//  -
+	const HashTab &GetHashTab() const {
+		return *hashTab;
 	}
 };
 
@@ -294,19 +482,21 @@ class FunctionSymbolTable : public SymbolTable
 	//    ,   
 	SymbolTableList	usingList;
 
-	//   
-	ListOfIdentifierList localIdList;
+	//  using-
+	mutable UsingClosure usingClosure;
+
+	//   using-,    
+	mutable unsigned closureGeneration;
+
+	//  
+	LocalIdentifierTable localIdList;
 
-	//  ,       
-	//  .    NameSpace
-	bool FindSymbolWithUsing( const CharString &name,
-					   SymbolTableList &tested, IdentifierList &out ) const;
 public:
 
 	//          
 	//   
 	FunctionSymbolTable( const Function &fn, const SymbolTable &p )
-		: pFunction(fn), parentST(p) {
+		: pFunction(fn), parentST(p), closureGeneration(0) {
 	}
 
 	//   
@@ -333,9 +523,17 @@ public:
 		return usingList;
 	}
 
+	//   using-,    
+	const UsingClosure &GetUsingClosure() const;
+
+	//   
+	const LocalIdentifierTable &GetIdentifierTable() const {
+		return localIdList;
+	}
+
 	//      ,     
 	//          
-	//       (using). 
+	//        (using). 
 	virtual bool FindSymbol( const NRC::CharString &name, IdentifierList &out ) const ;
 
 
@@ -355,26 +553,74 @@ public:
 //        
 class LocalSymbolTable : public SymbolTable
 {
-	//   
-	ListOfIdentifierList *table;
+	//   
+	LocalIdentifierTable table;
 
 	//   
-	const SymbolTable &parentST;
+	const SymbolTable *parentST;
+
+	// true,         :
+	//    ,     
+	//    
+	bool retained;
+
+	//    ,    
+	//   .  
+	static vector<LocalSymbolTable *> freeList;
+
+	//    .    
+	// ,       
+	static vector<LocalSymbolTable *> retainedList;
 
 public:
 	//   
 	LocalSymbolTable( const SymbolTable &pst )
-		: table(NULL), parentST(pst) {
+		: parentST(&pst), retained(false) {
+	}
+
+	//    ,     
+	//   
+	static LocalSymbolTable *Create( const SymbolTable &pst );
+
+	//        .  
+	//    ,     ,
+	//         
+	static void Release( LocalSymbolTable *lst );
+
+	//      . ,   
+	//   ,     
+	void Retain() {
+		retained = true;
+	}
+
+	//    .   
+	//  ,      
+	static unsigned GetRetainedCount() {
+		return retainedList.size();
 	}
 
-	//    
-	~LocalSymbolTable() {
-		delete table;
+	//  ,    mark.    
+	static void ForgetRetained( unsigned mark ) {
+		INTERNAL_IF( mark > retainedList.size() );
+		retainedList.resize(mark);
 	}
 
+	//   ,    mark,   
+	//   fst      
+	// .      ,  
+	//      ,    .
+	//    owned      .
+	//  true,   
+	static bool ReleaseFunctionScope( unsigned mark, FunctionSymbolTable *fst,
+		const vector<const Identifier *> &owned );
+
+	//   ,    
+	//  
+	static void ReleaseFreeList();
+
 	//   
 	const SymbolTable &GetParentSymbolTable() const {
-		return parentST;
+		return *parentST;
 	}
 
 	//  	
@@ -383,6 +629,11 @@ public:
 	//   
 	bool InsertSymbol( Identifier *id );
 
+	//   
+	const LocalIdentifierTable &GetIdentifierTable() const {
+		return table;
+	}
+
 	//   
 	void ClearTable() {
 		// delete headId;
@@ -443,12 +694,50 @@ public:
 };
 
  
+//    :    , 
+//      ,   ,  
+//   .  ,   
+//           
+struct LookupStamp
+{
+	//  ,   
+	vector< pair<const SymbolTable *, unsigned> > chain;
+
+	//   
+	unsigned generation;
+};
+
+
 //    
 class Scope
 {
 	//    ,   
 	list<SymbolTable *> symbolTableStack;
 
+	//   
+	struct SearchResult
+	{
+		//  ,      
+		IdentifierList found;
+
+		// ,     
+		LookupStamp stamp;
+	};
+
+	//    .    ,
+	//   .     ,  
+	//    ,        
+	//  ,         
+	mutable map<const SymbolTable *, map<string, SearchResult> > searchCache;
+
+	//  ,        
+	//    .      , 
+	//       
+	void ForgetSearchResults( const SymbolTable *st ) {
+		if( st->IsLocalSymbolTable() || st->IsFunctionSymbolTable() )
+			searchCache.erase(st);
+	}
+
 public:
 	//     ,  
 	//     
@@ -491,9 +780,19 @@ public:
 	//     ,  
 	//       
 	void DestroySymbolTable() {
+		ForgetSearchResults(symbolTableStack.back());
 		symbolTableStack.pop_back();
 	}
 
+	//          
+	//  .     LocalSymbolTable::Create
+	void DestroyLocalSymbolTable() {
+		INTERNAL_IF( !symbolTableStack.back()->IsLocalSymbolTable() );
+		LocalSymbolTable *lst = static_cast<LocalSymbolTable *>(symbolTableStack.back());
+		DestroySymbolTable();
+		LocalSymbolTable::Release(lst);
+	}
+
 	//    
 	void PushSymbolTableList( SymbolTableList &stl ) {
 		for( int i = 0; i<stl.GetSymbolTableCount(); i++ )
@@ -510,8 +809,14 @@ public:
 	//      , 
 	//    , ..     
 	//   -   
-	//  .  .  - false
-	bool DeepSearch( const CharString &name, IdentifierList &out ) const;
+	//  .  .  - false.   ls,  
+	//   
+	bool DeepSearch( const CharString &name, IdentifierList &out, 
+		LookupStamp *ls = NULL ) const;
+
+	// true,       ls 
+	//     
+	bool IsActual( const LookupStamp &ls ) const;
 };
 
 
@@ -321,26 +321,25 @@ const DerivedTypeList &SMFGenegator::MakeDTL0() const
 
 //         
 //          
-//    
-const DerivedTypeList &SMFGenegator::MakeDTL1( bool isConst ) const
+//    .    , ..
+//          
+//   
+DerivedTypeList SMFGenegator::MakeDTL1( bool isConst ) const
 {		
-	static FunctionParametrList fpl;
+	FunctionParametrList fpl;
 		
 	//  
-	static DerivedTypeList prmDtl;
 	static PDerivedType ref = new Reference;
-	if( prmDtl.IsEmpty() )
-		prmDtl.AddDerivedType(ref);		
+	DerivedTypeList prmDtl;
+	prmDtl.AddDerivedType(ref);		
 
 	//    
-	fpl.ClearFunctionParametrList();
 	fpl.AddFunctionParametr( new Parametr(&pClass, isConst, false, prmDtl, "src",
 		&pClass, NULL, false) );
 
 	//    
 	static FunctionThrowTypeList fttl;	
-	static DerivedTypeList dtl;
-	dtl.ClearDerivedTypeList();
+	DerivedTypeList dtl;
 	dtl.AddDerivedType( new FunctionPrototype(false, false, fpl, fttl, true, false) );
 	dtl.AddDerivedType( new Reference );
 	return dtl;
@@ -1101,6 +1100,14 @@ const string &ExpressionGenerator::PrintPathToBase( const ClassType &cur, const
 	if( &cur == &base )	
 		return out;	
 
+	//       
+	if( const ClassHierarchyIndex *hix = cur.GetHierarchyIndex() )
+	{
+		const ClassHierarchyIndex::BaseEntry *be = hix->FindBase(base);
+		INTERNAL_IF( be == NULL );
+		return be->path;
+	}
+
 	INTERNAL_IF( !PrintPathToBase(cur, base, out) );
 	return out;
 }
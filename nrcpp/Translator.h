@@ -108,7 +108,7 @@ class SMFGenegator
 
 	//         
 	//          
-	const DerivedTypeList &MakeDTL1( bool isConst ) const;
+	DerivedTypeList MakeDTL1( bool isConst ) const;
 
 	//    
 	ConstructorMethod *MakeDefCtor( bool trivial ) const;